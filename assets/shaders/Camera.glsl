@@ -0,0 +1,142 @@
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_TexCoord;
+
+uniform mat4 u_ViewProjection;
+
+out vec2 v_TexCoord;
+
+void main() {
+  v_TexCoord = a_TexCoord;
+  gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
+
+//// ---------------------------------------------- ////
+//// ---------------------------------------------- ////
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec2 v_TexCoord;
+
+// Must match CameraShaderFormat in Renderer2D.cpp
+const int FORMAT_RGB = 0;   // u_Plane0: RGB(A), BGR frames are swizzled during upload
+const int FORMAT_NV12 = 1;  // u_Plane0: Y (R8), u_Plane1: UV (RG8, half size)
+const int FORMAT_YUYV = 2;  // u_Plane0: Y0 U Y1 V (RGBA8, half width)
+const int FORMAT_I420 = 3;  // u_Plane0: Y, u_Plane1: U, u_Plane2: V (R8, U and V half size)
+
+uniform int u_Format;
+uniform sampler2D u_Plane0;
+uniform sampler2D u_Plane1;
+uniform sampler2D u_Plane2;
+uniform vec2 u_FrameSize;  // Full frame size in pixels
+
+// Lens undistortion: u_Remap maps each undistorted image position to its position in the camera
+// image (RG32F, normalized, row 0 at the top of the image)
+uniform bool u_Undistort;
+uniform bool u_BottomUp;  // Frame rows are stored bottom-up, the texture coordinates are flipped
+uniform sampler2D u_Remap;
+
+// Image adjustments, all skipped when u_Adjust is false (see ImageAdjustments in Camera.hpp)
+uniform bool u_Adjust;
+uniform float u_Exposure;      // Linear gain
+uniform vec3 u_WhiteBalance;   // Linear gains per channel
+uniform float u_Contrast;      // Around mid gray
+uniform float u_Gamma;
+uniform float u_Sharpen;       // Unsharp mask amount, 0 = off
+uniform float u_SharpenRadius; // In frame pixels
+uniform bool u_FalseColor;
+
+// BT.601 limited range, what camera ISPs and most encoders produce
+vec3 YUVToRGB(float y, float u, float v) {
+  y = (y - 16.0 / 255.0) * 1.164;
+  u -= 0.5;
+  v -= 0.5;
+  return vec3(y + 1.596 * v, y - 0.392 * u - 0.813 * v, y + 2.017 * u);
+}
+
+vec3 SampleFrame(vec2 texCoord) {
+  if (u_Format == FORMAT_NV12) {
+    float y = texture(u_Plane0, texCoord).r;
+    vec2 uv = texture(u_Plane1, texCoord).rg;
+    return clamp(YUVToRGB(y, uv.x, uv.y), 0.0, 1.0);
+  } else if (u_Format == FORMAT_I420) {
+    float y = texture(u_Plane0, texCoord).r;
+    float u = texture(u_Plane1, texCoord).r;
+    float v = texture(u_Plane2, texCoord).r;
+    return clamp(YUVToRGB(y, u, v), 0.0, 1.0);
+  } else if (u_Format == FORMAT_YUYV) {
+    // Each texel holds two pixels; pick the luma of the one under this fragment
+    ivec2 pixel = ivec2(texCoord * u_FrameSize);
+    pixel = clamp(pixel, ivec2(0), ivec2(u_FrameSize) - 1);
+    vec4 pair = texelFetch(u_Plane0, ivec2(pixel.x / 2, pixel.y), 0);
+    float y = (pixel.x % 2 == 0) ? pair.r : pair.b;
+    return clamp(YUVToRGB(y, pair.g, pair.a), 0.0, 1.0);
+  }
+  return texture(u_Plane0, texCoord).rgb;
+}
+
+// Polynomial approximation of the Turbo colormap (Mikhailov, 2019)
+vec3 Turbo(float x) {
+  const vec4 red4 = vec4(0.13572138, 4.61539260, -42.66032258, 132.13108234);
+  const vec4 green4 = vec4(0.09140261, 2.19418839, 4.84296658, -14.18503333);
+  const vec4 blue4 = vec4(0.10667330, 12.64194608, -60.58204836, 110.36276771);
+  const vec2 red2 = vec2(-152.94239396, 59.28637943);
+  const vec2 green2 = vec2(4.27729857, 2.82956604);
+  const vec2 blue2 = vec2(-89.90310912, 27.34824973);
+
+  x = clamp(x, 0.0, 1.0);
+  vec4 v4 = vec4(1.0, x, x * x, x * x * x);
+  vec2 v2 = v4.zw * v4.z;
+  return vec3(dot(v4, red4) + dot(v2, red2), dot(v4, green4) + dot(v2, green2),
+              dot(v4, blue4) + dot(v2, blue2));
+}
+
+// Every adjustment in one pass over the fragment, so enabling them costs no extra render target
+vec3 Adjust(vec3 rgb, vec2 texCoord) {
+  if (u_Sharpen > 0.0) {
+    // Unsharp mask against a four-tap blur; the taps go through the same color conversion
+    vec2 offset = u_SharpenRadius / u_FrameSize;
+    vec3 blur = SampleFrame(texCoord + vec2(offset.x, 0.0)) +
+                SampleFrame(texCoord - vec2(offset.x, 0.0)) +
+                SampleFrame(texCoord + vec2(0.0, offset.y)) +
+                SampleFrame(texCoord - vec2(0.0, offset.y));
+    rgb = clamp(rgb + u_Sharpen * (rgb - blur * 0.25), 0.0, 1.0);
+  }
+
+  // Exposure and white balance are gains on light, so they apply to linear values
+  vec3 linear = pow(rgb, vec3(2.2)) * u_Exposure * u_WhiteBalance;
+  rgb = pow(clamp(linear, 0.0, 1.0), vec3(1.0 / 2.2));
+
+  rgb = clamp((rgb - 0.5) * u_Contrast + 0.5, 0.0, 1.0);
+  rgb = pow(rgb, vec3(1.0 / u_Gamma));
+
+  if (u_FalseColor) {
+    rgb = Turbo(dot(rgb, vec3(0.299, 0.587, 0.114)));
+  }
+  return rgb;
+}
+
+void main() {
+  vec2 texCoord = v_TexCoord;
+  if (u_Undistort) {
+    vec2 image = u_BottomUp ? vec2(texCoord.x, 1.0 - texCoord.y) : texCoord;
+    vec2 source = texture(u_Remap, image).rg;
+    // Outside the camera image, like cv::remap's constant border
+    if (any(lessThan(source, vec2(0.0))) || any(greaterThan(source, vec2(1.0)))) {
+      color = vec4(0.0, 0.0, 0.0, 1.0);
+      return;
+    }
+    texCoord = u_BottomUp ? vec2(source.x, 1.0 - source.y) : source;
+  }
+
+  vec3 rgb = SampleFrame(texCoord);
+  if (u_Adjust) {
+    rgb = Adjust(rgb, texCoord);
+  }
+  color = vec4(rgb, 1.0);
+}
@@ -0,0 +1,63 @@
+#type compute
+#version 430 core
+
+// Histogram of log2 linear luminance over a camera frame, for AutoExposure. Every workgroup
+// counts its samples in shared memory and adds them to the global bins once.
+
+layout(local_size_x = 16, local_size_y = 16) in;
+
+// Must match AutoExposure::Source
+const int SOURCE_RGB = 0;   // RGB(A) texture
+const int SOURCE_Y = 1;     // Limited range luma plane (R8)
+const int SOURCE_YUYV = 2;  // Y0 U Y1 V texels (RGBA8)
+
+// Must match AutoExposure.cpp
+const int BIN_COUNT = 64;
+const float MIN_LOG2 = -10.0;  // Bin 0 holds everything darker
+const float MAX_LOG2 = 0.0;
+
+uniform sampler2D u_Texture;
+uniform int u_Source;
+uniform int u_Step;  // Samples every u_Step-th texel in each direction
+
+layout(std430, binding = 0) buffer Histogram {
+  uint b_Bins[BIN_COUNT];
+};
+
+shared uint s_Bins[BIN_COUNT];
+
+void AddSample(float value) {
+  float luminance = pow(clamp(value, 0.0, 1.0), 2.2);
+  int bin = 0;
+  if (luminance > exp2(MIN_LOG2)) {
+    float position = (log2(luminance) - MIN_LOG2) / (MAX_LOG2 - MIN_LOG2);
+    bin = clamp(int(position * float(BIN_COUNT - 1)) + 1, 1, BIN_COUNT - 1);
+  }
+  atomicAdd(s_Bins[bin], 1u);
+}
+
+void main() {
+  uint local = gl_LocalInvocationIndex;
+  if (local < uint(BIN_COUNT)) {
+    s_Bins[local] = 0u;
+  }
+  barrier();
+
+  ivec2 texel = ivec2(gl_GlobalInvocationID.xy) * u_Step;
+  if (all(lessThan(texel, textureSize(u_Texture, 0)))) {
+    vec4 value = texelFetch(u_Texture, texel, 0);
+    if (u_Source == SOURCE_RGB) {
+      AddSample(dot(value.rgb, vec3(0.299, 0.587, 0.114)));
+    } else if (u_Source == SOURCE_Y) {
+      AddSample((value.r - 16.0 / 255.0) * 1.164);
+    } else {
+      AddSample((value.r - 16.0 / 255.0) * 1.164);
+      AddSample((value.b - 16.0 / 255.0) * 1.164);
+    }
+  }
+  barrier();
+
+  if (local < uint(BIN_COUNT) && s_Bins[local] > 0u) {
+    atomicAdd(b_Bins[local], s_Bins[local]);
+  }
+}
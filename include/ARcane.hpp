@@ -14,3 +14,28 @@
 #include "ARcane/Renderer/Texture.hpp"
 #include "ARcane/Core/Timestep.hpp"
 #include "ARcane/Camera/CameraStream.hpp"
+#include "ARcane/Renderer/GPUTimer.hpp"
+#include "ARcane/Debug/RendererStatsPanel.hpp"
+#include "ARcane/Renderer/Framebuffer.hpp"
+#include "ARcane/Renderer/AsyncReadback.hpp"
+#include "ARcane/Camera/StreamPublisher.hpp"
+#include "ARcane/Camera/SessionRecorder.hpp"
+#include "ARcane/Camera/SessionReader.hpp"
+#include "ARcane/Camera/ReplaySource.hpp"
+#include "ARcane/Camera/SessionPlayer.hpp"
+#include "ARcane/Debug/SessionTimelinePanel.hpp"
+#include "ARcane/Camera/SyntheticPublisher.hpp"
+#include "ARcane/Core/Histogram.hpp"
+#include "ARcane/Camera/FrameHeader.hpp"
+#include "ARcane/Camera/CameraStreamManager.hpp"
+#include "ARcane/Camera/DecodeScheduler.hpp"
+#include "ARcane/Camera/FrameDecoder.hpp"
+#include "ARcane/Camera/VideoDecoder.hpp"
+#include "ARcane/Camera/SharedFrameRing.hpp"
+#include "ARcane/Camera/FramePool.hpp"
+#include "ARcane/Camera/FramePacer.hpp"
+#include "ARcane/Renderer/AutoExposure.hpp"
+#include "ARcane/Camera/StreamStats.hpp"
+#include "ARcane/Debug/StreamStatsPanel.hpp"
+#include "ARcane/Camera/StreamStatsExporter.hpp"
+#include "ARcane/Debug/ProfilerPanel.hpp"
@@ -2,9 +2,52 @@
 
 #include <glm/glm.hpp>
 #include <glm/ext/matrix_clip_space.hpp>
+#include <array>
+#include <cstdint>
 
 namespace ARcane {
 
+// Pinhole model with Brown-Conrady distortion, as produced by cv::calibrateCamera. All values are
+// in pixels of the calibration image, origin at the center of the top left pixel, y pointing
+// down.
+struct CameraIntrinsics {
+    glm::vec2 FocalLength = {0.0f, 0.0f};     // fx, fy
+    glm::vec2 PrincipalPoint = {0.0f, 0.0f};  // cx, cy
+    glm::vec2 ImageSize = {0.0f, 0.0f};       // Resolution the camera was calibrated at
+    std::array<float, 5> Distortion = {};     // k1, k2, p1, p2, k3 in OpenCV order
+
+    bool IsValid() const {
+        return FocalLength.x > 0.0f && FocalLength.y > 0.0f && ImageSize.x > 0.0f &&
+               ImageSize.y > 0.0f;
+    }
+    bool HasDistortion() const;
+
+    // Where a pixel of the undistorted image lies in the distorted camera image
+    glm::vec2 Distort(const glm::vec2& pixel) const;
+};
+
+// Image processing applied by Renderer2D::DrawCameraStream in the camera shader, in the same pass
+// as the color conversion. Exposure is the camera's GetExposure().
+struct ImageAdjustments {
+    glm::vec3 WhiteBalance = glm::vec3(1.0f);  // Linear gains per RGB channel
+    float Contrast = 1.0f;                     // Around mid gray, 1 = unchanged
+    float Gamma = 1.0f;                        // Above 1 brightens the midtones
+    float Sharpen = 0.0f;                      // Unsharp mask amount, 0 = off
+    float SharpenRadius = 1.0f;                // In pixels of the decoded frame
+    bool FalseColor = false;                   // Luminance as a heat map, to judge exposure
+};
+
+// Auto exposure, metered on the GPU by Renderer2D::DrawCameraStream (see AutoExposure)
+struct AutoExposureSettings {
+    float TargetLuminance = 0.18f;  // Linear average luminance to aim for, mid gray by default
+    float MinExposure = 0.25f;
+    float MaxExposure = 8.0f;
+    float AdaptationRate = 2.0f;  // Per second, higher adapts faster
+    // Darkest and brightest shares of the pixels left out of the average
+    float LowPercentile = 0.1f;
+    float HighPercentile = 0.95f;
+};
+
 class Camera {
    public:
     Camera() = default;
@@ -29,14 +72,47 @@ class Camera {
             glm::ortho(-width * 0.5f, width * 0.5f, -height * 0.5f, height * 0.5f, farP, nearP);
     }
 
+    // Linear gain applied to camera frames, 1 = as received
     inline float GetExposure() const { return m_Exposure; }
     inline float& GetExposure() { return m_Exposure; }
 
+    inline const ImageAdjustments& GetImageAdjustments() const { return m_ImageAdjustments; }
+    inline ImageAdjustments& GetImageAdjustments() { return m_ImageAdjustments; }
+    inline void SetImageAdjustments(const ImageAdjustments& adjustments) {
+        m_ImageAdjustments = adjustments;
+    }
+    // False when the exposure and every adjustment are neutral, so drawing can skip them
+    bool HasImageAdjustments() const;
+
+    // With auto exposure, the renderer keeps adjusting GetExposure() to the frames' brightness
+    inline void SetAutoExposure(bool enabled) { m_AutoExposureEnabled = enabled; }
+    inline bool IsAutoExposureEnabled() const { return m_AutoExposureEnabled; }
+    inline const AutoExposureSettings& GetAutoExposureSettings() const {
+        return m_AutoExposureSettings;
+    }
+    inline AutoExposureSettings& GetAutoExposureSettings() { return m_AutoExposureSettings; }
+
+    // Frames drawn with Renderer2D::DrawCameraStream are undistorted on the GPU when the
+    // intrinsics have distortion coefficients
+    void SetIntrinsics(const CameraIntrinsics& intrinsics);
+    inline const CameraIntrinsics& GetIntrinsics() const { return m_Intrinsics; }
+    // Incremented by SetIntrinsics(), so renderers know when to rebuild derived data
+    inline uint32_t GetIntrinsicsVersion() const { return m_IntrinsicsVersion; }
+
+    // Projection matching the intrinsics, so overlays line up with the undistorted image.
+    // Same depth convention as SetPerspectiveProjectionMatrix().
+    void SetProjectionFromIntrinsics(const float nearP, const float farP);
+
    protected:
-    float m_Exposure = 0.8f;
+    float m_Exposure = 1.0f;
+    ImageAdjustments m_ImageAdjustments;
+    bool m_AutoExposureEnabled = false;
+    AutoExposureSettings m_AutoExposureSettings;
 
    private:
     glm::mat4 m_ProjectionMatrix = glm::mat4(1.0f);
+    CameraIntrinsics m_Intrinsics;
+    uint32_t m_IntrinsicsVersion = 0;
 };
 
 }  // namespace ARcane
\ No newline at end of file
@@ -2,15 +2,72 @@
 
 #include "ARcane/Core/Core.hpp"
 #include "ARcane/Camera/Camera.hpp"
+#include "ARcane/Camera/SessionRecorder.hpp"
+#include "ARcane/Camera/FrameHeader.hpp"
+#include "ARcane/Camera/FrameDecoder.hpp"
+#include "ARcane/Camera/VideoDecoder.hpp"
+#include "ARcane/Camera/FramePool.hpp"
+#include "ARcane/Camera/FramePacer.hpp"
+#include "ARcane/Camera/StreamStats.hpp"
+#include "ARcane/Core/Histogram.hpp"
 #include <opencv2/opencv.hpp>
 #include <zmq.hpp>
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <condition_variable>
+#include <chrono>
 #include <string>
 
 namespace ARcane {
 
+// Where a decoded frame came from and when it passed each stage
+struct FrameInfo {
+    uint64_t Index = 0;  // Frames decoded by the stream so far, 0 = no frame yet
+    bool HasHeader = false;
+    FrameHeader Header;  // Valid if HasHeader (multipart message)
+
+    uint64_t ReceiveNs = 0;  // Steady clock times (GetSteadyClockNs)
+    uint64_t DecodeStartNs = 0;
+    uint64_t DecodedNs = 0;
+    uint64_t ReceiveWallNs = 0;  // Only compared with Header.CaptureTimestampNs, 0 if unknown
+
+    FramePixelFormat Format = FramePixelFormat::BGR;  // Layout of the decoded frame
+    bool BottomUp = false;
+
+    // Bare messages are JPEG, so only a header can mark a frame as depending on earlier ones
+    bool IsKeyframe() const { return !HasHeader || Header.IsKeyframe(); }
+
+    // Capture time (publisher's wall clock) if the publisher sent it, otherwise receive time
+    // (steady clock). Only differences between frames of one stream are meaningful.
+    uint64_t GetOriginNs() const {
+        return HasHeader && Header.CaptureTimestampNs ? Header.CaptureTimestampNs : ReceiveNs;
+    }
+};
+
+// Per-stage latencies in microseconds
+struct LatencyHistograms {
+    Histogram Receive;  // Capture to receive (network and publisher queues), needs a header
+    Histogram Decode;   // Receive to decoded
+    Histogram Upload;   // Decoded to texture upload submitted
+    Histogram Present;  // Capture (or receive) to the first buffer swap showing the frame
+
+    void Reset() {
+        Receive.Reset();
+        Decode.Reset();
+        Upload.Reset();
+        Present.Reset();
+    }
+};
+
+// How a stream decodes its frames, usually set by a DecodeScheduler
+struct DecodeSettings {
+    uint32_t Scale = 1;         // 1, 2, 4 or 8: decode at a fraction of the source resolution
+    float MaxFrameRate = 0.0f;  // Frames decoded per second at most (0 = every frame)
+};
+
+class CameraStreamManager;
+
 class CameraStream : public Camera {
    public:
     CameraStream(const glm::mat4& projection);
@@ -18,20 +75,170 @@ class CameraStream : public Camera {
 
     Camera& GetCamera() { return *this; }
 
+    // Receives on a dedicated thread. Streams added to a CameraStreamManager must not call this.
+    // shm://name reads frames in place from a SharedFrameWriter on the same machine, any other
+    // URL connects a ZMQ subscriber.
     void StartSubscriberThread(const std::string& url);
 
+    // Context of the subscriber socket, needed by publishers binding an inproc:// address.
+    // Created on first use; managed streams share the manager's context instead.
+    zmq::context_t& GetContext();
+
+    // True once the stream receives on its own thread or through a CameraStreamManager
+    inline bool IsReceiving() const { return m_Running || m_Manager; }
+
+    inline uint64_t GetReceivedCount() const { return m_Stats.GetReceivedCount(); }
+    // Frames missing from the header (or synthetic stamp) sequence numbers
+    inline uint64_t GetLostCount() const { return m_Stats.GetDroppedCount(FrameDropReason::Lost); }
+    // Frames replaced by a newer one before they were decoded (managed and shm:// streams), or
+    // overwritten in shared memory while they were decoded
+    inline uint64_t GetSkippedCount() const {
+        return m_Stats.GetDroppedCount(FrameDropReason::Skipped);
+    }
+    // Frames not decoded because of DecodeSettings::MaxFrameRate
+    inline uint64_t GetRateLimitedCount() const {
+        return m_Stats.GetDroppedCount(FrameDropReason::RateLimited);
+    }
+
+    // Rates, bitrate, decode time, drops by reason and frame ages; lock-free, from any thread.
+    // StreamStatsPanel shows them and StreamStatsExporter writes them to a file.
+    inline const StreamStats& GetStats() const { return m_Stats; }
+
+    // Replaces the decoder (FrameDecoder::Create() by default). Call before receiving starts.
+    void SetDecoder(Scope<FrameDecoder> decoder);
+
+    // Used for H.264/H.265 streams, whose decoder is created on the first such frame. Call
+    // before receiving starts.
+    void SetVideoDecoderSettings(const VideoDecoderSettings& settings);
+
+    // Layout GetFrame() returns, BGR top-down by default. RGBA bottom-up is uploaded by
+    // Renderer2D::DrawCameraStream without any conversion.
+    void SetOutputFormat(FramePixelFormat format, bool bottomUp);
+
+    // Takes effect from the next received frame
+    void SetDecodeSettings(const DecodeSettings& settings);
+    DecodeSettings GetDecodeSettings() const;
+
+    // Full resolution of the source, whatever scale it is decoded at (0 before the first frame)
+    glm::ivec2 GetSourceSize() const;
+    // Encoding of the last decoded frame, JPEG before the first one
+    inline FrameEncoding GetSourceEncoding() const { return m_SourceEncoding; }
+
+    // Raw NV12 and YUYV frames are returned as received and video frames as I420 (see
+    // FrameInfo::Format); draw them with Renderer2D::DrawCameraStream, which converts them on
+    // the GPU. GetFrame() returns a copy the caller owns.
     cv::Mat GetFrame() const;
+    cv::Mat GetFrame(FrameInfo& info) const;
+
+    // The current frame without copying it. The buffer stays untouched while the handle is held
+    // and goes back to the stream's pool when it is dropped, so hold it only as long as needed.
+    FrameBuffer AcquireFrame(FrameInfo& info) const;
+    // With frame pacing, the frame scheduled for a buffer swap reaching the screen at displayNs
+    // (wall clock), or an empty handle if no new frame is due. The latest frame otherwise.
+    FrameBuffer AcquireFrame(FrameInfo& info, uint64_t displayNs);
+
+    // Frame pacing evens out network jitter with a small adaptive jitter buffer (see FramePacer).
+    // Off by default: AcquireFrame() always returns the latest frame. Can change at any time.
+    void SetFramePacingSettings(const FramePacingSettings& settings);
+    FramePacingSettings GetFramePacingSettings() const;
+    FramePacer::Stats GetFramePacingStats() const;
+
+    // Decoded frames live in a pool of capacity preallocated buffers (4 by default): the back
+    // frame, the current frame and the ones held through AcquireFrame(). Call before receiving
+    // starts.
+    void SetFramePoolSettings(uint32_t capacity, bool hugePages = false);
+
+    // Index of the latest decoded frame, cheap enough to poll every frame
+    uint64_t GetFrameIndex() const;
+
+    // Decodes a compressed frame as if it had been received (e.g. from a ReplaySource). False if
+    // no frame was published: check GetRateLimitedCount() to tell a rate limited frame apart.
+    bool PushFrame(const void* data, size_t size, FrameInfo info = FrameInfo());
+
+    inline LatencyHistograms& GetLatency() { return m_Latency; }
+    inline const LatencyHistograms& GetLatency() const { return m_Latency; }
+
+    // Called by Renderer2D when a frame is uploaded and when it first reaches the screen, with
+    // steady clock times
+    void RecordUploaded(const FrameInfo& info, uint64_t uploadedNs);
+    void RecordPresented(const FrameInfo& info, uint64_t presentedNs);
+    // Expires when the stream is destroyed; lets the renderer drop state it keeps for the stream
+    // without the stream having to call into it
+    inline std::weak_ptr<const void> GetLifetime() const { return m_Lifetime; }
+
+    // Blocks until the latest frame was taken with GetFrame(), or the timeout expires
+    bool WaitForFrameConsumed(std::chrono::milliseconds timeout) const;
+
+    // Appends every received payload, as is, to the recorder (nullptr stops recording)
+    void SetRecorder(const Ref<SessionRecorder>& recorder);
+
+    // Capture mode: records every received payload to a file that ReplaySource can play back
+    bool StartCapture(const std::string& path);
+    void StopCapture();
 
    private:
+    friend class CameraStreamManager;
+
+    // Receives one (possibly multipart) message, counts it and hands it to the recorder.
+    // Returns false if nothing arrived (timeout or dontwait).
+    bool ReceiveMessage(zmq::socket_t& socket, zmq::message_t& payload, FrameInfo& info,
+                        zmq::recv_flags flags);
     void SubscriberLoop();
+    void SharedMemoryLoop(const std::string& name);
+    // Counts a received frame and hands it to the recorder
+    void OnFrameReceived(const void* payload, size_t size, FrameInfo& info);
+
+    // Decodes into the back frame, then PublishFrame() makes it the current frame
+    bool DecodeFrame(const void* data, size_t size, FrameInfo& info);
+    // Takes a pool buffer of this shape as the back frame
+    cv::Mat& PrepareBackFrame(int rows, int cols, int type);
+    void PublishFrame(FrameInfo& info);
+    bool CopyRawFrame(const void* data, size_t size, FrameInfo& info);
+    bool DecodeVideoFrame(const void* data, size_t size, FrameInfo& info);
 
-    cv::Mat m_Frame;
+    FrameBuffer m_Frame;
+    FrameBuffer m_BackFrame;  // Decoding thread only
+    Ref<FramePool> m_FramePool;  // Decoding thread only, created for the first frame
+    FramePoolSpecification m_FramePoolSpecification;
+    bool m_FramePoolExhaustedWarned = false;
+    FrameInfo m_FrameInfo;
+    Scope<FrameDecoder> m_Decoder;
+    Scope<VideoDecoder> m_VideoDecoder;  // Created for the first inter-frame coded frame
+    FrameEncoding m_VideoEncoding = FrameEncoding::JPEG;  // What m_VideoDecoder was created for
+    VideoDecoderSettings m_VideoDecoderSettings;
+    cv::Size m_VideoFrameSize;  // Of the last decoded video frame, I420 rows included
+    bool m_WaitForKeyframe = true;  // Decoding thread only, after a gap in the video frames
+    uint64_t m_LastVideoSequence = 0;
+    std::atomic<FramePixelFormat> m_OutputFormat = FramePixelFormat::BGR;
+    std::atomic_bool m_OutputBottomUp = false;
+    uint64_t m_LastPresentedIndex = 0;  // Render thread only
+    FramePacer m_Pacer;  // Holds its own references to the frames it queues
+    std::atomic_uint32_t m_PacedFrameCount = 0;  // Pool buffers the pacer may hold
+    mutable bool m_FrameConsumed = true;
     mutable std::mutex m_FrameMutex;
+    mutable std::condition_variable m_FrameConsumedCondition;
 
     std::atomic_bool m_Running;
     std::thread m_SubscriberThread;
-    zmq::context_t m_Context;
+    Scope<zmq::context_t> m_Context;
     zmq::socket_t m_Subscriber;
+    CameraStreamManager* m_Manager = nullptr;
+
+    static constexpr int ReceiveTimeoutMs = 100;  // Bounds how long shutdown waits for recv
+
+    uint64_t m_LastSequence = 0;  // Receiving thread only
+    StreamStats m_Stats;
+
+    std::atomic_uint32_t m_DecodeScale = 1;
+    std::atomic<float> m_MaxFrameRate = 0.0f;
+    uint64_t m_LastDecodeNs = 0;  // Decoding thread only
+    std::atomic_int m_SourceWidth = 0;
+    std::atomic_int m_SourceHeight = 0;
+    std::atomic<FrameEncoding> m_SourceEncoding = FrameEncoding::JPEG;
+    LatencyHistograms m_Latency;
+
+    Ref<SessionRecorder> m_Recorder;  // Accessed atomically, swapped from any thread
+    Ref<const void> m_Lifetime = CreateRef<char>();
 };
 
 }  // namespace ARcane
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Camera/CameraStream.hpp"
+#include <zmq.hpp>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+namespace ARcane {
+
+/**
+ * @class CameraStreamManager
+ * @brief Receives and decodes many camera streams with a fixed number of threads.
+ *
+ * All subscriber sockets share one ZMQ context and are serviced by a single I/O thread blocked in
+ * zmq_poll. Received payloads go into a per-stream queue that only ever holds the newest frame:
+ * if a frame arrives before the previous one was decoded, the older one is skipped (and still
+ * recorded). Inter-frame coded (H.264/H.265) frames cannot be skipped individually, so they
+ * queue up to MaxPendingVideoFrames and are only dropped when a keyframe arrives. A shared pool
+ * of decode threads takes the oldest pending frame of the highest priority stream first, and never
+ * decodes two frames of the same stream at once, so frames stay in order.
+ *
+ * Every blocking wait has a timeout, so Stop(), RemoveStream() and the destructor return within
+ * about PollTimeoutMs plus one decode.
+ *
+ * Example usage:
+ * @code
+ * m_Manager = CreateScope<CameraStreamManager>(2);
+ * m_Manager->AddStream(m_FrontCamera, "tcp://robot:5556", 10);
+ * m_Manager->AddStream(m_RearCamera, "tcp://robot:5557");
+ * m_Manager->Start();
+ * @endcode
+ */
+class CameraStreamManager {
+   public:
+    CameraStreamManager(uint32_t decodeThreads = 2);
+    ~CameraStreamManager();
+
+    /**
+     * @brief Connects a stream to a publisher. Can be called while running.
+     * @param stream Stream to feed. It removes itself from the manager when destroyed.
+     * @param url Publisher address.
+     * @param priority Streams with a higher priority are decoded first.
+     * @return False if the socket could not connect.
+     */
+    bool AddStream(CameraStream& stream, const std::string& url, int priority = 0);
+
+    /**
+     * @brief Disconnects a stream and waits for its decode in progress to finish.
+     */
+    void RemoveStream(CameraStream& stream);
+
+    void SetPriority(const CameraStream& stream, int priority);
+
+    void Start();
+    void Stop();
+
+    inline zmq::context_t& GetContext() { return m_Context; }
+    size_t GetStreamCount() const;
+
+   private:
+    struct Entry {
+        CameraStream* Stream = nullptr;
+        zmq::socket_t Socket;
+        int Priority = 0;
+
+        struct PendingFrame {
+            zmq::message_t Payload;
+            FrameInfo Info;
+        };
+        std::deque<PendingFrame> Pending;  // Undecoded payloads, oldest first
+        bool Decoding = false;
+        bool Removed = false;  // Waiting for the I/O thread to close the socket
+    };
+
+    void IOLoop();
+    void DecodeLoop();
+    Entry* FindEntry(const CameraStream& stream) const;  // Requires m_Mutex
+    Entry* NextDecodeEntry() const;                      // Requires m_Mutex
+
+    zmq::context_t m_Context;
+    uint32_t m_DecodeThreadCount;
+
+    std::vector<Scope<Entry>> m_Entries;
+    bool m_EntriesChanged = false;  // The I/O thread has to rebuild its poll set
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_DecodeCondition;  // Work available or stopping
+    std::condition_variable m_EntryCondition;   // A decode finished or a socket was closed
+
+    std::atomic_bool m_Running;
+    bool m_ThreadsActive = false;  // Between Start() and the end of Stop(), guarded by m_Mutex
+    std::thread m_IOThread;
+    std::vector<std::thread> m_DecodeThreads;
+
+    static constexpr long PollTimeoutMs = 50;
+    // Video frames queued behind a slow decoder before they are dropped up to the next keyframe
+    static constexpr size_t MaxPendingVideoFrames = 60;
+};
+
+}  // namespace ARcane
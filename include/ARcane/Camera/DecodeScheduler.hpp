@@ -0,0 +1,92 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Camera/CameraStream.hpp"
+#include <chrono>
+
+namespace ARcane {
+
+/**
+ * @class DecodeScheduler
+ * @brief Shares a CPU decode budget between the streams of a mosaic view.
+ *
+ * The application reports how large each stream is drawn and which one has focus. Once per
+ * frame, Update() picks the smallest JPEG decode scale (1, 1/2, 1/4 or 1/8) that still covers
+ * each tile's on-screen size, and limits unfocused streams to a lower frame rate. If the
+ * estimated decode load still exceeds the budget, the most expensive unfocused stream is degraded
+ * one step at a time (halving its rate, then its resolution) until it fits. The focused stream
+ * always keeps full resolution and rate.
+ *
+ * Load is measured in decoded megapixels per second, which is roughly proportional to JPEG
+ * decode time on a given machine.
+ *
+ * Only JPEG streams can be degraded. H.264/H.265 streams decode every access unit at full
+ * resolution whatever their settings, and raw frames are copied as received, so both are costed
+ * at full rate and resolution and never picked to make room in the budget.
+ *
+ * Example usage:
+ * @code
+ * m_Scheduler.AddStream(camera);
+ * ...
+ * m_Scheduler.SetViewHint(camera, tileSizeInPixels, camera == focused);
+ * m_Scheduler.Update();
+ * @endcode
+ */
+class DecodeScheduler {
+   public:
+    /**
+     * @param budget Decode budget in megapixels per second for all streams together.
+     */
+    DecodeScheduler(float budget = 200.0f);
+
+    void AddStream(CameraStream& stream);
+    void RemoveStream(CameraStream& stream);
+
+    /**
+     * @brief Reports how a stream is currently shown.
+     * @param size Size of the tile on screen in pixels (0 = not visible).
+     * @param focused Whether this is the stream the operator is looking at.
+     */
+    void SetViewHint(const CameraStream& stream, const glm::vec2& size, bool focused);
+
+    inline void SetBudget(float megapixelsPerSecond) { m_Budget = megapixelsPerSecond; }
+    inline float GetBudget() const { return m_Budget; }
+
+    // Frame rate of unfocused streams before any budget cuts
+    inline void SetUnfocusedFrameRate(float fps) { m_UnfocusedFrameRate = fps; }
+    // Unfocused streams are never limited below this rate
+    inline void SetMinFrameRate(float fps) { m_MinFrameRate = fps; }
+
+    /**
+     * @brief Recomputes and applies the decode settings of every stream. Call once per frame.
+     */
+    void Update();
+
+    // Estimated decode load after the last Update()
+    inline float GetLoad() const { return m_Load; }
+
+   private:
+    struct Entry {
+        CameraStream* Stream = nullptr;
+        glm::vec2 Size = {0.0f, 0.0f};
+        bool Focused = false;
+
+        float IncomingFrameRate = 0.0f;  // Smoothed, measured from the received count
+        uint64_t LastReceivedCount = 0;
+
+        DecodeSettings Settings;
+        float Cost = 0.0f;  // Megapixels per second with the current settings
+    };
+
+    float GetCost(const Entry& entry) const;
+
+    std::vector<Entry> m_Entries;
+    std::chrono::steady_clock::time_point m_LastUpdate;
+
+    float m_Budget;
+    float m_UnfocusedFrameRate = 10.0f;
+    float m_MinFrameRate = 2.0f;
+    float m_Load = 0.0f;
+};
+
+}  // namespace ARcane
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include <opencv2/opencv.hpp>
+
+namespace ARcane {
+
+enum class FramePixelFormat {
+    BGR,   // 3 bytes per pixel, what OpenCV works with
+    RGBA,  // 4 bytes per pixel, uploads to a texture without conversion
+    NV12,  // Raw frames only: full size Y plane followed by a half size interleaved UV plane
+    YUYV,  // Raw frames only: 4:2:2 packed, Y0 U Y1 V per pair of pixels
+    I420,  // Video frames only: Y plane followed by the half size U and V planes
+};
+
+struct DecodeOptions {
+    uint32_t Scale = 1;  // 1, 2, 4 or 8: decode at a fraction of the size (DCT scaling)
+    FramePixelFormat Format = FramePixelFormat::BGR;  // BGR or RGBA
+    bool BottomUp = false;  // First row is the bottom of the image, as OpenGL expects
+};
+
+/**
+ * @class FrameDecoder
+ * @brief Decodes compressed camera frames into a caller-provided buffer.
+ *
+ * Decoding into the caller's memory lets the destination be recycled (or be a mapped pixel
+ * buffer), and producing RGBA bottom-up rows directly removes the color conversion and flip
+ * before texture upload. A decoder instance is not thread safe; use one per decoding thread or
+ * per stream.
+ *
+ * Create() returns the fastest backend compiled in: libjpeg-turbo when ARC_HAS_TURBOJPEG is
+ * defined, OpenCV otherwise.
+ */
+class FrameDecoder {
+   public:
+    virtual ~FrameDecoder() = default;
+
+    virtual const char* GetName() const = 0;
+
+    /**
+     * @brief Reads the output size of a frame from its header, without decoding it.
+     * @return False if the data is not a frame this decoder understands.
+     */
+    virtual bool GetOutputSize(const void* data, size_t size, uint32_t scale, int& width,
+                               int& height) = 0;
+
+    /**
+     * @brief Decodes a frame into a buffer.
+     * @param output At least height * stride bytes.
+     * @param width, height Size the output was allocated for, from GetOutputSize().
+     * @param stride Bytes between the starts of two rows.
+     * @return False if the frame does not decode to exactly width x height, e.g. because the
+     * data changed since GetOutputSize() read it. Nothing is written past the output then.
+     */
+    virtual bool Decode(const void* data, size_t size, const DecodeOptions& options,
+                        uint8_t* output, int width, int height, size_t stride) = 0;
+
+    /**
+     * @brief Decodes a frame into a matrix, reusing its memory if it already has the right size.
+     */
+    bool Decode(const void* data, size_t size, const DecodeOptions& options, cv::Mat& output);
+
+    static Scope<FrameDecoder> Create();
+
+   protected:
+    // Reads the size from the SOF segment of a JPEG
+    static bool ReadJpegSize(const void* data, size_t size, int& width, int& height);
+    // Whether a buffer of the given stride holds width x height pixels of the options' format
+    static bool CheckOutput(const DecodeOptions& options, int width, int height, size_t stride);
+};
+
+// Fallback backend: cv::imdecode with reduced decoding, then conversion into the output
+class OpenCVDecoder : public FrameDecoder {
+   public:
+    const char* GetName() const override { return "OpenCV"; }
+
+    bool GetOutputSize(const void* data, size_t size, uint32_t scale, int& width,
+                       int& height) override;
+    bool Decode(const void* data, size_t size, const DecodeOptions& options, uint8_t* output,
+                int width, int height, size_t stride) override;
+
+   private:
+    cv::Mat m_Decoded;  // Reused between frames
+};
+
+#ifdef ARC_HAS_TURBOJPEG
+// libjpeg-turbo backend: decodes straight into the output in the requested layout
+class TurboJpegDecoder : public FrameDecoder {
+   public:
+    TurboJpegDecoder();
+    ~TurboJpegDecoder();
+
+    const char* GetName() const override { return "libjpeg-turbo"; }
+
+    bool GetOutputSize(const void* data, size_t size, uint32_t scale, int& width,
+                       int& height) override;
+    bool Decode(const void* data, size_t size, const DecodeOptions& options, uint8_t* output,
+                int width, int height, size_t stride) override;
+
+   private:
+    void* m_Handle = nullptr;  // tjhandle
+};
+#endif
+
+}  // namespace ARcane
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+
+namespace ARcane {
+
+/*
+    ============================
+    Camera message framing
+    ============================
+
+    Single part:  [payload]                  Bare JPEG, as sent by older publishers
+    Multipart:    [FrameHeader][payload]     Header first, then the encoded frame
+
+    The header is a fixed 40 byte little-endian struct. Receivers ignore headers with an unknown
+    magic and treat the message as a bare payload. Timestamps are wall clock nanoseconds since
+    the Unix epoch; latencies measured across machines are only as good as their clock sync.
+*/
+
+constexpr uint32_t FrameHeaderMagic = 0x46435241u;  // "ARCF"
+constexpr uint16_t FrameHeaderVersion = 1;
+
+enum class FrameEncoding : uint16_t {
+    JPEG = 0,
+    // Uncompressed, top-down rows without padding; Width and Height are required
+    NV12 = 1,  // Y plane (Width x Height) then interleaved UV plane (Width x Height / 2), even
+    YUYV = 2,  // Width x Height x 2 bytes, even Width
+    BGR = 3,   // Width x Height x 3 bytes
+    RGBA = 4,  // Width x Height x 4 bytes
+    // Inter-frame coded, one Annex B access unit per message. Frames depend on earlier ones, so
+    // publishers set FrameHeaderKeyframe on IDR frames and receivers must not drop in between.
+    H264 = 5,
+    H265 = 6,
+};
+
+// FrameHeader::Flags
+constexpr uint32_t FrameHeaderKeyframe = 1u << 0;  // Decodable without any earlier frame
+
+inline bool IsInterFrameEncoding(FrameEncoding encoding) {
+    return encoding == FrameEncoding::H264 || encoding == FrameEncoding::H265;
+}
+
+#pragma pack(push, 1)
+
+struct FrameHeader {
+    uint32_t Magic = FrameHeaderMagic;
+    uint16_t Version = FrameHeaderVersion;
+    FrameEncoding Encoding = FrameEncoding::JPEG;
+    uint64_t Sequence = 0;            // Per camera, increments by one per frame
+    uint64_t CaptureTimestampNs = 0;  // When the sensor produced the frame
+    uint32_t Width = 0;
+    uint32_t Height = 0;
+    uint32_t CameraId = 0;
+    uint32_t Flags = 0;  // Was reserved (always 0) before inter-frame encodings
+
+    // Every frame of an intra-only encoding is a keyframe
+    bool IsKeyframe() const {
+        return !IsInterFrameEncoding(Encoding) || (Flags & FrameHeaderKeyframe);
+    }
+
+    /**
+     * @brief Reads a header from the first part of a multipart message.
+     * @return False if the data is not a FrameHeader.
+     */
+    static bool Parse(const void* data, size_t size, FrameHeader& header) {
+        // Message buffers are not guaranteed to be aligned, so copy the 40 bytes out
+        if (size < sizeof(FrameHeader)) return false;
+        memcpy(&header, data, sizeof(FrameHeader));
+        return header.Magic == FrameHeaderMagic;
+    }
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(FrameHeader) == 40, "FrameHeader is a wire format");
+
+/*
+    Bare JPEGs have no header, but can carry a sequence number and send time in a comment (COM)
+    segment right after the SOI marker, which decoders skip:
+
+    FF D8 | FF FE | length (big-endian, includes itself) | "ARCS" | sequence | timestamp | ...
+
+    Sequence and timestamp are little-endian uint64, with the same meaning as in FrameHeader.
+*/
+
+constexpr uint8_t JpegStampMagic[4] = {'A', 'R', 'C', 'S'};
+
+struct JpegStamp {
+    static constexpr size_t SegmentSize = 4 + sizeof(JpegStampMagic) + 2 * sizeof(uint64_t);
+    static constexpr size_t PayloadOffset = 2 + 4 + sizeof(JpegStampMagic);  // From the SOI
+
+    uint64_t Sequence = 0;
+    uint64_t TimestampNs = 0;
+
+    /**
+     * @brief Reads the stamp of a JPEG.
+     * @return False if the JPEG carries no stamp.
+     */
+    static bool Parse(const void* data, size_t size, JpegStamp& stamp) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        if (size < 2 + SegmentSize || bytes[2] != 0xFF || bytes[3] != 0xFE ||
+            memcmp(bytes + 6, JpegStampMagic, sizeof(JpegStampMagic)) != 0) {
+            return false;
+        }
+        memcpy(&stamp.Sequence, bytes + PayloadOffset, sizeof(stamp.Sequence));
+        memcpy(&stamp.TimestampNs, bytes + PayloadOffset + sizeof(stamp.Sequence),
+               sizeof(stamp.TimestampNs));
+        return true;
+    }
+
+    // Writes an empty stamp segment; a JPEG has to make room for it after its SOI marker
+    static void WriteSegment(uint8_t* segment) {
+        segment[0] = 0xFF;
+        segment[1] = 0xFE;
+        segment[2] = (uint8_t)((SegmentSize - 2) >> 8);
+        segment[3] = (uint8_t)((SegmentSize - 2) & 0xFF);
+        memcpy(segment + 4, JpegStampMagic, sizeof(JpegStampMagic));
+        memset(segment + 4 + sizeof(JpegStampMagic), 0, 2 * sizeof(uint64_t));
+    }
+
+    // Fills in the stamp of a JPEG that has the segment
+    void Write(uint8_t* jpeg) const {
+        memcpy(jpeg + PayloadOffset, &Sequence, sizeof(Sequence));
+        memcpy(jpeg + PayloadOffset + sizeof(Sequence), &TimestampNs, sizeof(TimestampNs));
+    }
+};
+
+// Current wall clock time in the time base of FrameHeader::CaptureTimestampNs
+inline uint64_t GetWallClockNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+// Monotonic time for intervals measured within the process. Unlike GetWallClockNs() it never
+// steps, but it is not comparable with timestamps from other processes.
+inline uint64_t GetSteadyClockNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+}  // namespace ARcane
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Camera/FramePool.hpp"
+#include <vector>
+
+namespace ARcane {
+
+struct FrameInfo;
+
+struct FramePacingSettings {
+    // Off is latest-frame mode: every frame is shown as soon as it is decoded
+    bool Enabled = false;
+    float MinDelayMs = 0.0f;
+    // Hard cap on the delay the jitter buffer adds, whatever the measured jitter
+    float MaxDelayMs = 100.0f;
+    // Target delay in multiples of the measured jitter; higher is smoother but later
+    float JitterMultiplier = 3.0f;
+    uint32_t MaxFrames = 8;  // Frames waiting at most, each holds a pool buffer
+};
+
+/**
+ * @class FramePacer
+ * @brief Adaptive jitter buffer that schedules decoded frames against display times.
+ *
+ * Frames are timestamped at capture, but arrive and finish decoding in clumps. The pacer measures
+ * the transit time (decoded minus capture time) of every frame, tracks its lower envelope and its
+ * jitter, and delays each frame to capture time + lowest transit + target delay, where the target
+ * delay is a multiple of the jitter clamped to [MinDelayMs, MaxDelayMs]. The target grows as soon
+ * as the jitter does and shrinks slowly, so a single late frame does not cause a series of them.
+ *
+ * Select() then returns the frame whose scheduled time is closest to the time the next buffer swap
+ * will reach the screen; frames passed over are dropped. No frame is held longer than MaxDelayMs.
+ * Capture and decode times may come from different clocks, only their difference is used. Frames
+ * without a capture timestamp are paced by receive time, which only evens out decoding jitter.
+ *
+ * Not thread-safe: CameraStream calls it under its frame lock.
+ */
+class FramePacer {
+   public:
+    struct Stats {
+        float JitterMs = 0.0f;
+        float TargetDelayMs = 0.0f;
+        uint32_t QueuedFrames = 0;
+        uint64_t DroppedCount = 0;  // Replaced by a newer frame before they were shown
+        uint64_t LateCount = 0;     // Shown because of the delay cap rather than on schedule
+    };
+
+    FramePacer(const FramePacingSettings& settings = FramePacingSettings());
+    ~FramePacer();
+
+    FramePacer(const FramePacer&) = delete;
+    FramePacer& operator=(const FramePacer&) = delete;
+
+    void SetSettings(const FramePacingSettings& settings);
+    inline const FramePacingSettings& GetSettings() const { return m_Settings; }
+    inline bool IsEnabled() const { return m_Settings.Enabled; }
+
+    // Queues a decoded frame, dropping the oldest one if the buffer is full
+    void Push(const FrameBuffer& frame, const FrameInfo& info);
+
+    /**
+     * @brief Takes the frame to show at a given time.
+     * @param displayNs Steady clock time the next buffer swap is expected to reach the screen.
+     * @return False if no queued frame is due yet; keep showing the previous one.
+     */
+    bool Select(uint64_t displayNs, FrameBuffer& frame, FrameInfo& info);
+
+    // Releases the queued frames and forgets the measured jitter
+    void Reset();
+
+    Stats GetStats() const;
+
+   private:
+    struct Entry;  // FrameInfo is defined by CameraStream.hpp, which includes this header
+
+    int64_t GetBaseTransitNs() const;
+
+    FramePacingSettings m_Settings;
+    std::vector<Entry> m_Frames;  // Oldest first, capacity reserved up front
+
+    // Jitter estimation, in nanoseconds
+    bool m_HasTransit = false;
+    int64_t m_LastTransitNs = 0;
+    int64_t m_LastOriginNs = 0;
+    double m_JitterNs = 0.0;
+    double m_FrameIntervalNs = 0.0;
+    double m_TargetDelayNs = 0.0;
+
+    // Lowest transit over the current and the previous window, so clock drift is followed
+    int64_t m_WindowMinNs = 0;
+    int64_t m_PreviousWindowMinNs = 0;
+    int64_t m_WindowStartNs = 0;
+
+    uint64_t m_DroppedCount = 0;
+    uint64_t m_LateCount = 0;
+};
+
+}  // namespace ARcane
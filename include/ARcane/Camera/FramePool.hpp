@@ -0,0 +1,113 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ARcane {
+
+class FramePool;
+
+/**
+ * @class FrameBuffer
+ * @brief Reference-counted handle to a decoded frame, usually living in a FramePool.
+ *
+ * Copying a handle only bumps a counter; the buffer goes back to its pool when the last handle
+ * is dropped. GetMat() is a matrix header over the buffer and must not outlive the handle.
+ * Frames that did not fit in a pool are ordinary heap matrices behind the same interface.
+ */
+class FrameBuffer {
+   public:
+    FrameBuffer() = default;
+    FrameBuffer(const FrameBuffer& other);
+    FrameBuffer(FrameBuffer&& other) noexcept;
+    FrameBuffer& operator=(const FrameBuffer& other);
+    FrameBuffer& operator=(FrameBuffer&& other) noexcept;
+    ~FrameBuffer();
+
+    // Heap-allocated frame, the fallback when no pool buffer is available
+    static FrameBuffer Allocate(int rows, int cols, int type);
+
+    inline cv::Mat& GetMat() { return m_Mat; }
+    inline const cv::Mat& GetMat() const { return m_Mat; }
+    inline bool IsPooled() const { return m_Slot != nullptr; }
+    inline explicit operator bool() const { return !m_Mat.empty(); }
+
+    void Reset();
+
+   private:
+    friend class FramePool;
+    struct Slot;
+
+    cv::Mat m_Mat;
+    Slot* m_Slot = nullptr;
+    Ref<FramePool> m_Pool;  // Keeps the pool's memory mapped while the buffer is in use
+};
+
+struct FrameBuffer::Slot {
+    uint8_t* Data = nullptr;
+    uint32_t Index = 0;
+    std::atomic_uint32_t RefCount = 0;
+
+    Slot() = default;
+    Slot(const Slot& other) : Data(other.Data), Index(other.Index) {}  // Only while building
+};
+
+struct FramePoolSpecification {
+    uint32_t Capacity = 4;  // Buffers, all allocated up front
+    size_t BufferSize = 0;  // Bytes per buffer, rounded up to whole (huge) pages
+    // Back the buffers with 2 MB pages: explicit hugetlbfs pages if the system has some reserved,
+    // transparent huge pages otherwise. Fewer TLB misses when decoding 4K frames.
+    bool HugePages = false;
+};
+
+/**
+ * @class FramePool
+ * @brief Fixed set of preallocated, page-aligned frame buffers.
+ *
+ * All buffers come from one anonymous mapping that is populated when the pool is created, so
+ * steady-state streaming causes neither heap allocations nor page faults: a decoder writes into a
+ * buffer from Acquire(), the renderer holds a handle while it uploads, and releasing the last
+ * handle puts the buffer back on the free list. The free list is preallocated, so releasing never
+ * allocates either.
+ *
+ * Create pools with CreateRef: handles keep their pool alive, so a pool can be replaced (e.g.
+ * when the frame size grows) while the renderer still holds frames from the old one.
+ */
+class FramePool : public std::enable_shared_from_this<FramePool> {
+   public:
+    FramePool(const FramePoolSpecification& spec);
+    ~FramePool();
+
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    inline bool IsValid() const { return m_Memory != nullptr; }
+    inline size_t GetBufferSize() const { return m_BufferSize; }
+    inline uint32_t GetCapacity() const { return m_Specification.Capacity; }
+    uint32_t GetAvailableCount() const;
+
+    /**
+     * @brief Takes a free buffer and wraps it in a continuous matrix of the given shape.
+     * @return An empty handle if every buffer is in use or the shape does not fit.
+     */
+    FrameBuffer Acquire(int rows, int cols, int type);
+
+   private:
+    friend class FrameBuffer;
+    void Release(FrameBuffer::Slot* slot);
+
+    FramePoolSpecification m_Specification;
+    size_t m_BufferSize = 0;
+    uint8_t* m_Memory = nullptr;
+    size_t m_MemorySize = 0;
+
+    std::vector<FrameBuffer::Slot> m_Slots;
+    std::vector<uint32_t> m_FreeSlots;  // Capacity reserved up front
+    mutable std::mutex m_Mutex;
+};
+
+}  // namespace ARcane
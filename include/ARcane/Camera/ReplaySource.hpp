@@ -0,0 +1,106 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Camera/CameraStream.hpp"
+#include "ARcane/Camera/SessionReader.hpp"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+namespace ARcane {
+
+enum class ReplayMode {
+    Realtime,         // Frames are pushed at their original receive times
+    AsFastAsPossible  // Each frame is pushed as soon as the renderer took the previous one
+};
+
+/**
+ * @class ReplaySource
+ * @brief Plays a recording captured with CameraStream::StartCapture() back into a CameraStream.
+ *
+ * The file is memory-mapped and every payload is decoded in file order. In AsFastAsPossible
+ * mode the replay runs in lockstep with the renderer: a frame is only pushed once the previous
+ * one has been taken with GetFrame(), so every frame is decoded and rendered exactly once and
+ * benchmark runs see the same sequence of frames every time. The input checksum can be compared
+ * between runs to confirm the same data was replayed.
+ *
+ * Recordings hold the payloads without their FrameHeader, so frames are pushed without one and
+ * decoded as bare JPEG messages. Raw (NV12, YUYV, BGR, RGBA) and H.264/H.265 recordings, whose
+ * encoding and size are only in the header, cannot be replayed.
+ *
+ * Example usage:
+ * @code
+ * m_Replay = CreateScope<ReplaySource>("session.arcrec");
+ * m_Replay->Start(m_Stream, ReplayMode::AsFastAsPossible);
+ * @endcode
+ */
+class ReplaySource {
+   public:
+    struct Statistics {
+        uint64_t FramesDecoded = 0;
+        uint64_t FramesRateLimited = 0;  // Skipped by the stream's DecodeSettings::MaxFrameRate
+        uint64_t DecodeFailures = 0;
+        uint64_t FramesRendered = 0;  // Frames taken by the renderer before the next was pushed
+        double DecodeSeconds = 0.0;   // Time spent inside the decoder
+        double WallSeconds = 0.0;     // Time since Start()
+        uint64_t InputChecksum = 0;   // FNV-1a over every replayed payload
+
+        double GetDecodeFPS() const {
+            return DecodeSeconds > 0.0 ? FramesDecoded / DecodeSeconds : 0.0;
+        }
+        double GetRenderFPS() const {
+            return WallSeconds > 0.0 ? FramesRendered / WallSeconds : 0.0;
+        }
+    };
+
+    ReplaySource(const std::string& path);
+    ~ReplaySource();
+
+    inline bool IsOpen() const { return m_Reader.IsOpen(); }
+    inline const SessionReader& GetReader() const { return m_Reader; }
+
+    /**
+     * @brief Starts pushing frames into the stream from a replay thread.
+     * @param stream Stream to feed. It must outlive the replay and be idle: a stream that is
+     * already receiving (StartSubscriberThread() or a CameraStreamManager) is refused, since its
+     * decoding thread would race the replay thread.
+     * @param mode Original timing or lockstep as fast as possible.
+     * @param loop Start over at the end instead of finishing.
+     */
+    void Start(CameraStream& stream, ReplayMode mode, bool loop = false);
+
+    /**
+     * @brief Stops the replay thread.
+     */
+    void Stop();
+
+    inline bool IsFinished() const { return m_Finished; }
+
+    /**
+     * @brief Gets a snapshot of the throughput counters (safe to call while running).
+     */
+    Statistics GetStats() const;
+
+   private:
+    void ReplayLoop(CameraStream& stream, ReplayMode mode, bool loop);
+
+    SessionReader m_Reader;
+
+    std::atomic_bool m_Running;
+    std::atomic_bool m_Finished;
+    std::thread m_ReplayThread;
+    std::mutex m_StopMutex;
+    std::condition_variable m_StopCondition;  // Interrupts the wait for the next record
+    std::chrono::steady_clock::time_point m_StartTime;
+
+    std::atomic_uint64_t m_FramesDecoded = 0;
+    std::atomic_uint64_t m_FramesRateLimited = 0;
+    std::atomic_uint64_t m_DecodeFailures = 0;
+    std::atomic_uint64_t m_FramesRendered = 0;
+    std::atomic_uint64_t m_DecodeNs = 0;
+    std::atomic_uint64_t m_InputChecksum = 0;
+    std::atomic_uint64_t m_EndNs = 0;  // Wall time at which the replay finished (0 = running)
+};
+
+}  // namespace ARcane
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ARcane {
+
+/*
+    ============================
+    Session recording file layout
+    ============================
+
+    [SessionFileHeader, padded to SessionBlockSize]
+    [Chunk]...
+    [SessionIndexEntry]...[padding][SessionIndexFooter]   (optional)
+
+    Chunk:
+    [SessionChunkHeader][SessionRecordHeader][payload]...[SessionRecordHeader][payload][padding]
+
+    Every chunk starts on a SessionBlockSize boundary and its size (ChunkBytes) is a multiple of
+    SessionBlockSize, so each chunk is written with one large aligned write. Payloads are the
+    compressed frames exactly as they were received. All integers are little-endian.
+
+    The index is written once when the recording is stopped cleanly. It holds one entry per record,
+    in file order, and the footer occupies the last bytes of the file so a reader can find it
+    without scanning. A file without a valid footer (e.g. after a crash) is still readable: the
+    reader rebuilds the index by walking the chunks.
+*/
+
+constexpr uint32_t SessionBlockSize = 4096;
+constexpr uint64_t SessionFileMagic = 0x3130434552435241ull;  // "ARCREC01"
+constexpr uint32_t SessionChunkMagic = 0x4B4E4843u;           // "CHNK"
+constexpr uint32_t SessionIndexMagic = 0x58444E49u;           // "INDX"
+constexpr uint32_t SessionVersion = 1;
+
+// SessionRecordHeader::Flags
+constexpr uint32_t SessionRecordKeyframe = 1 << 0;  // Decodable without any earlier record
+
+#pragma pack(push, 1)
+
+struct SessionFileHeader {
+    uint64_t Magic = SessionFileMagic;
+    uint32_t Version = SessionVersion;
+    uint32_t BlockSize = SessionBlockSize;
+    uint64_t CreatedNs = 0;  // Wall clock time the recording started
+};
+
+struct SessionChunkHeader {
+    uint32_t Magic = SessionChunkMagic;
+    uint32_t RecordCount = 0;
+    uint64_t PayloadBytes = 0;  // Bytes of records following this header
+    uint64_t ChunkBytes = 0;    // Total size of the chunk including header and padding
+};
+
+struct SessionRecordHeader {
+    uint64_t TimestampNs = 0;  // Wall clock receive time
+    uint32_t Size = 0;         // Payload size in bytes
+    uint32_t Flags = 0;
+};
+
+struct SessionIndexEntry {
+    uint64_t TimestampNs = 0;
+    uint64_t Offset = 0;  // File offset of the SessionRecordHeader
+    uint32_t Size = 0;
+    uint32_t Flags = 0;
+};
+
+struct SessionIndexFooter {
+    uint32_t Magic = SessionIndexMagic;
+    uint32_t Reserved = 0;
+    uint64_t EntryCount = 0;
+    uint64_t IndexOffset = 0;  // File offset of the first SessionIndexEntry
+};
+
+#pragma pack(pop)
+
+}  // namespace ARcane
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Core/Timestep.hpp"
+#include "ARcane/Camera/SessionReader.hpp"
+#include <opencv2/opencv.hpp>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <map>
+
+namespace ARcane {
+
+/**
+ * @class SessionPlayer
+ * @brief Random-access playback of a recording for review and scrubbing.
+ *
+ * Seeking only looks the position up in the index and hands it to a background decode thread, so
+ * it never blocks the caller. The decode thread decodes the requested frame first, then the frames
+ * around it (mostly ahead, in playback direction) into a small cache, and asks the kernel to read
+ * the following payloads ahead of time. If the position moves while it is working, it drops what
+ * it was doing and starts from the new position, so fast scrubbing only decodes the frames that
+ * are actually looked at. GetFrame() returns the newest frame available for the position and
+ * keeps showing the previous one until it is decoded.
+ *
+ * Example usage:
+ * @code
+ * auto player = CreateRef<SessionPlayer>("session.arcrec");
+ * PushOverlay(new SessionTimelinePanel(player));
+ * ...
+ * Renderer2D::DrawCVMat(player->GetFrame(), { 0.0f, 0.0f }, { 1.6f, 0.9f });
+ * @endcode
+ */
+class SessionPlayer {
+   public:
+    /**
+     * @param path Recording written by SessionRecorder.
+     * @param cacheSize Number of decoded frames kept around the position.
+     */
+    SessionPlayer(const std::string& path, uint32_t cacheSize = 32);
+    ~SessionPlayer();
+
+    inline bool IsOpen() const { return m_Reader.IsOpen() && m_Reader.GetRecordCount() > 0; }
+    inline const SessionReader& GetReader() const { return m_Reader; }
+
+    // Moves the position; the frame is decoded in the background
+    void Seek(uint64_t timestampNs);
+    void SeekToRecord(size_t index);
+    void Step(int frames);
+
+    inline void SetPlaying(bool playing) { m_Playing = playing; }
+    inline bool IsPlaying() const { return m_Playing; }
+    inline void SetSpeed(float speed) { m_Speed = speed; }
+    inline float GetSpeed() const { return m_Speed; }
+
+    /**
+     * @brief Advances the position while playing. Call once per frame.
+     */
+    void OnUpdate(Timestep ts);
+
+    inline uint64_t GetPositionNs() const { return m_PositionNs; }
+    inline size_t GetCurrentRecord() const { return m_Target; }
+
+    /**
+     * @brief Gets the frame for the current position without waiting for the decoder.
+     * @return The frame at the position, or the last one shown if it is not decoded yet.
+     */
+    cv::Mat GetFrame() const;
+
+    size_t GetCachedCount() const;
+    inline uint64_t GetDecodedCount() const { return m_DecodedCount; }
+
+   private:
+    void SetTarget(size_t index);
+    void DecodeLoop();
+
+    SessionReader m_Reader;
+    uint32_t m_CacheSize;
+
+    // Owned by the caller's thread
+    uint64_t m_PositionNs = 0;
+    bool m_Playing = false;
+    float m_Speed = 1.0f;
+    mutable cv::Mat m_Shown;
+
+    std::atomic<size_t> m_Target;        // Record the caller wants to see
+    std::map<size_t, cv::Mat> m_Cache;   // Decoded frames by record index
+    mutable std::mutex m_CacheMutex;
+    std::condition_variable m_TargetCondition;
+
+    std::atomic_bool m_Running;
+    std::thread m_DecodeThread;
+    std::atomic_uint64_t m_DecodedCount = 0;
+
+    static constexpr size_t PrefetchRecords = 128;  // Payloads read ahead of the position
+};
+
+}  // namespace ARcane
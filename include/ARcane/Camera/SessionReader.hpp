@@ -0,0 +1,87 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Camera/SessionFormat.hpp"
+
+namespace ARcane {
+
+/**
+ * @class SessionReader
+ * @brief Memory-maps a file written by SessionRecorder and indexes its records.
+ *
+ * Payloads are not copied: each Record points straight into the mapping, which stays valid for
+ * the lifetime of the reader. The record table is built from the index footer when there is one,
+ * which only touches the end of the file. Otherwise the chunks are scanned once to rebuild it, and
+ * a truncated last chunk (e.g. after a crash) is ignored.
+ *
+ * Timestamps are wall clock and can go backwards if the clock was stepped during the recording.
+ * Records then stay in file order, and seeking falls back to a linear scan.
+ */
+class SessionReader {
+   public:
+    struct Record {
+        uint64_t TimestampNs;  // Wall clock receive time
+        const uint8_t* Data;   // Compressed payload inside the mapping
+        uint32_t Size;
+        uint32_t Flags;
+    };
+
+    SessionReader(const std::string& path);
+    ~SessionReader();
+
+    SessionReader(const SessionReader&) = delete;
+    SessionReader& operator=(const SessionReader&) = delete;
+
+    inline bool IsOpen() const { return m_Mapping != nullptr; }
+    inline const std::string& GetPath() const { return m_Path; }
+
+    inline size_t GetRecordCount() const { return m_Records.size(); }
+    inline const Record& GetRecord(size_t index) const { return m_Records[index]; }
+    inline bool HasIndex() const { return m_HasIndex; }
+
+    // Earliest and latest timestamps, which are the first and last records unless the clock
+    // was stepped
+    inline uint64_t GetStartNs() const { return m_StartNs; }
+    inline uint64_t GetEndNs() const { return m_EndNs; }
+    inline bool IsSorted() const { return m_Sorted; }
+
+    /**
+     * @brief Finds the record shown at a given time, in O(log n) (O(n) if not IsSorted()).
+     * @param timestampNs Wall clock time, clamped to the recording.
+     * @return Index of the last record, in file order, at or before the time.
+     */
+    size_t FindRecord(uint64_t timestampNs) const;
+
+    /**
+     * @brief Finds the keyframe decoding has to start from to show a record, in O(log n).
+     * @return Index of the last keyframe at or before the record (the record itself for JPEG).
+     */
+    size_t FindKeyframe(size_t index) const;
+
+    /**
+     * @brief Asks the kernel to read the payloads of a range of records ahead of time.
+     */
+    void Prefetch(size_t first, size_t count) const;
+
+    /**
+     * @brief Gets the time between the first and the last record.
+     * @return Duration in nanoseconds (0 if there are fewer than two records).
+     */
+    uint64_t GetDurationNs() const;
+
+   private:
+    bool ReadIndex();
+    void ScanChunks();
+
+    std::string m_Path;
+    const uint8_t* m_Mapping = nullptr;
+    size_t m_MappingSize = 0;
+    std::vector<Record> m_Records;      // Sorted by file order, which is receive order
+    std::vector<uint32_t> m_Keyframes;  // Indices of records flagged SessionRecordKeyframe
+    bool m_HasIndex = false;
+    bool m_Sorted = true;  // Timestamps never decrease, FindRecord() can binary search
+    uint64_t m_StartNs = 0;
+    uint64_t m_EndNs = 0;
+};
+
+}  // namespace ARcane
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Camera/SessionFormat.hpp"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <chrono>
+
+namespace ARcane {
+
+/**
+ * @class SessionRecorder
+ * @brief Appends received compressed frames and their timestamps to a chunked file.
+ *
+ * Append() only copies the payload into the current chunk buffer. Full chunks are handed to a
+ * dedicated writer thread that writes each one with a single block-aligned write(), so recording
+ * never re-encodes and costs little more than a memcpy on the caller's thread. If the disk falls
+ * behind and every chunk buffer is waiting to be written, frames are dropped instead of blocking.
+ *
+ * An index of every record (timestamp, file offset, keyframe flag) is kept in memory and written
+ * as a footer by Stop(), so SessionReader can seek without scanning the file.
+ *
+ * See SessionFormat.hpp for the file layout.
+ */
+class SessionRecorder {
+   public:
+    /**
+     * @brief Creates the file and starts the writer thread.
+     * @param path File to create (truncated if it exists).
+     * @param chunkSize Size of each chunk buffer in bytes, rounded up to SessionBlockSize.
+     * @param chunkCount Number of chunk buffers.
+     */
+    SessionRecorder(const std::string& path, uint32_t chunkSize = 8 * 1024 * 1024,
+                    uint32_t chunkCount = 4);
+    ~SessionRecorder();
+
+    /**
+     * @brief Copies one frame into the current chunk.
+     * @param data Compressed frame.
+     * @param size Size of the frame in bytes.
+     * @param timestampNs Wall clock receive time in nanoseconds.
+     * @param flags SessionRecordKeyframe for frames decodable on their own.
+     * @return False if the frame was dropped.
+     */
+    bool Append(const void* data, uint32_t size, uint64_t timestampNs, uint32_t flags = 0);
+
+    /**
+     * @brief Writes the partially filled chunk and the index, waits for the writer and closes
+     * the file.
+     */
+    void Stop();
+
+    inline bool IsOpen() const { return m_File >= 0; }
+    inline const std::string& GetPath() const { return m_Path; }
+
+    inline uint64_t GetRecordedCount() const { return m_RecordedCount; }
+    inline uint64_t GetDroppedCount() const { return m_DroppedCount; }
+    inline uint64_t GetBytesWritten() const { return m_BytesWritten; }
+
+    // Current wall clock time in the format Append() expects
+    static uint64_t Now();
+
+   private:
+    struct Chunk {
+        uint8_t* Data = nullptr;  // SessionBlockSize aligned
+        uint64_t Used = 0;        // Bytes used including the chunk header
+        uint32_t RecordCount = 0;
+        uint64_t FileOffset = 0;  // Where the chunk will be written
+        std::chrono::steady_clock::time_point Started;
+    };
+
+    bool AcquireChunk();      // Takes a free chunk as the current one
+    void SubmitChunk();       // Hands the current chunk to the writer thread
+    void SubmitStaleChunk();  // From the writer thread, when no new frame submitted it
+    void WriterLoop();
+    bool WriteAll(const uint8_t* data, uint64_t size);
+    void WriteIndex();
+
+    std::string m_Path;
+    int m_File = -1;
+    uint32_t m_ChunkSize;
+
+    std::vector<Chunk> m_Chunks;
+    Chunk* m_Current = nullptr;        // Guarded by m_AppendMutex
+    std::mutex m_AppendMutex;
+    uint64_t m_NextChunkOffset = SessionBlockSize;  // Guarded by m_AppendMutex
+    std::vector<SessionIndexEntry> m_Index;         // Guarded by m_AppendMutex
+    std::vector<Chunk*> m_FreeChunks;  // Ready to be filled
+    std::deque<Chunk*> m_FullChunks;   // Waiting for the writer
+    std::mutex m_ChunkMutex;
+    std::condition_variable m_ChunkCondition;
+
+    std::atomic_bool m_Running;
+    std::thread m_WriterThread;
+    std::atomic_bool m_WriteFailed = false;  // Offsets in the index can no longer be trusted
+
+    std::atomic_uint64_t m_RecordedCount = 0;
+    std::atomic_uint64_t m_DroppedCount = 0;
+    std::atomic_uint64_t m_BytesWritten = 0;
+
+    static constexpr std::chrono::seconds FlushInterval{1};  // Max age of a partial chunk
+};
+
+}  // namespace ARcane
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Camera/FrameHeader.hpp"
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace ARcane {
+
+/*
+    ============================
+    Shared memory frame ring
+    ============================
+
+    [SharedRingHeader, padded to SharedRingHeaderSize][slot 0]...[slot SlotCount - 1]
+
+    Slot:  [SharedSlotHeader][payload, up to SlotSize bytes][padding to SlotStride]
+
+    A single writer puts frame n into slot n % SlotCount. Each slot is a seqlock: its Version is
+    2n + 1 while frame n is being written and 2n + 2 once it is complete. Readers use payloads in
+    place and compare the Version before and after; if it changed, the writer lapped them and the
+    frame is thrown away. Readers never block the writer and any number of them can attach.
+
+    WriteSequence counts complete frames. Readers sleep on the Notify futex word, which the writer
+    increments after every frame; the wake-up system call is only made when Waiters is non-zero.
+    Readers only ever write Waiters.
+*/
+
+constexpr uint32_t SharedRingMagic = 0x48535241u;  // "ARSH"
+constexpr uint32_t SharedRingVersion = 1;
+constexpr size_t SharedRingHeaderSize = 4096;
+
+struct SharedRingHeader {
+    std::atomic_uint32_t Magic;  // Stored last by the writer, once the ring is ready
+    uint32_t Version;
+    uint32_t SlotCount;
+    uint32_t SlotSize;    // Largest payload a slot can hold
+    uint64_t SlotStride;  // Bytes between two slot headers
+    std::atomic_uint32_t Closed;  // Set when the writer goes away; readers have to reopen
+
+    alignas(64) std::atomic_uint64_t WriteSequence;
+    alignas(64) std::atomic_uint32_t Notify;
+    std::atomic_uint32_t Waiters;
+};
+
+struct alignas(64) SharedSlotHeader {
+    std::atomic_uint64_t Version;
+    uint64_t Size;
+    FrameHeader Header;
+};
+
+static_assert(sizeof(SharedRingHeader) <= SharedRingHeaderSize, "Ring header too large");
+static_assert(std::atomic_uint32_t::is_always_lock_free &&
+                  std::atomic_uint64_t::is_always_lock_free,
+              "Atomics shared between processes must be lock-free");
+
+/**
+ * @class SharedFrameWriter
+ * @brief Publishes frames to readers on the same machine through a POSIX shared memory ring.
+ *
+ * Meant for a camera driver running next to the UI: compared to ZMQ over tcp:// or ipc://, no
+ * frame goes through the kernel, and a frame can be written straight into the ring with
+ * BeginFrame()/CommitFrame(). The shared memory object is removed when the writer is destroyed.
+ */
+class SharedFrameWriter {
+   public:
+    /**
+     * @param name Shared memory object name, as in shm://name.
+     * @param slotCount Frames kept in the ring, bounds how far a slow reader can fall behind.
+     * @param slotSize Largest frame in bytes.
+     */
+    SharedFrameWriter(const std::string& name, uint32_t slotCount, uint32_t slotSize);
+    ~SharedFrameWriter();
+
+    SharedFrameWriter(const SharedFrameWriter&) = delete;
+    SharedFrameWriter& operator=(const SharedFrameWriter&) = delete;
+
+    inline bool IsOpen() const { return m_Mapping != nullptr; }
+    inline uint32_t GetSlotSize() const { return m_Header->SlotSize; }
+
+    // Returns the payload buffer of the next slot (GetSlotSize() bytes), already marked as being
+    // written. Must be followed by CommitFrame().
+    uint8_t* BeginFrame();
+    void CommitFrame(const FrameHeader& header, size_t size);
+
+    // Copies a frame into the ring. False if it is larger than a slot.
+    bool Publish(const FrameHeader& header, const void* data, size_t size);
+
+   private:
+    SharedSlotHeader* GetSlot(uint64_t sequence) const;
+
+    std::string m_Name;
+    uint8_t* m_Mapping = nullptr;
+    size_t m_MappingSize = 0;
+    SharedRingHeader* m_Header = nullptr;
+    uint64_t m_Sequence = 0;  // Frame being written
+};
+
+/**
+ * @class SharedFrameReader
+ * @brief Reads frames from a SharedFrameWriter in place.
+ *
+ * Frames are taken in order, except that the reader jumps ahead to the newest frame when it is a
+ * keyframe (everything older is obsolete) or when the writer lapped it. A frame's data points
+ * into the shared ring and may be overwritten at any time; IsValid() tells afterwards whether it
+ * was.
+ */
+class SharedFrameReader {
+   public:
+    struct Frame {
+        const uint8_t* Data = nullptr;  // Inside the ring
+        size_t Size = 0;
+        FrameHeader Header;
+        uint64_t Sequence = 0;  // Position in the ring, not FrameHeader::Sequence
+    };
+
+    SharedFrameReader(const std::string& name);
+    ~SharedFrameReader();
+
+    SharedFrameReader(const SharedFrameReader&) = delete;
+    SharedFrameReader& operator=(const SharedFrameReader&) = delete;
+
+    inline bool IsOpen() const { return m_Mapping != nullptr; }
+    // The writer was destroyed; a new one creates a new ring, which needs a new reader
+    inline bool IsClosed() const { return m_Header->Closed.load(std::memory_order_acquire); }
+    // Closed, or the name now refers to another ring: a writer that crashed never closes its
+    // ring, and its replacement creates a new one. Looks the name up, so only call it when idle.
+    bool IsStale() const;
+
+    // Blocks until a frame newer than the last acquired one is available, or the timeout expires
+    bool Wait(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Takes the next frame without blocking.
+     * @param skipped Frames jumped over to get to it.
+     * @return False if there is no new frame.
+     */
+    bool Acquire(Frame& frame, uint64_t& skipped);
+
+    // False if the writer has started overwriting the frame since Acquire()
+    bool IsValid(const Frame& frame) const;
+
+   private:
+    bool ReadSlot(uint64_t sequence, Frame& frame) const;
+
+    std::string m_ObjectName;
+    uint64_t m_Inode = 0;  // Of the shared memory object, which a new writer replaces
+    uint8_t* m_Mapping = nullptr;
+    size_t m_MappingSize = 0;
+    SharedRingHeader* m_Header = nullptr;
+    uint64_t m_Next = 0;  // Next frame to read
+};
+
+}  // namespace ARcane
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Renderer/AsyncReadback.hpp"
+#include <opencv2/opencv.hpp>
+#include <zmq.hpp>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <string>
+
+namespace ARcane {
+
+struct StreamPublisherSpecification {
+    std::string Url = "tcp://*:5556";  // Address the PUB socket binds to
+    float FrameRate = 15.0f;           // Maximum frames published per second
+    int JpegQuality = 80;              // 0-100
+    uint32_t Workers = 2;              // JPEG encoder threads
+};
+
+/**
+ * @class StreamPublisher
+ * @brief Publishes the composed view (camera feed plus overlays) as a JPEG stream over ZMQ.
+ *
+ * Frames are read back with an AsyncReadback attached to the Application, so the GPU is never
+ * stalled. The render thread only copies the pixels into a recycled buffer. Flipping, color
+ * conversion, JPEG encoding and sending happen on a pool of worker threads. When every worker is
+ * busy the frame is dropped rather than slowing down rendering, and frames that finish encoding
+ * after a newer one was sent are discarded so subscribers never go back in time.
+ *
+ * Each message is a single JPEG, the same framing CameraStream subscribes to.
+ *
+ * Example usage:
+ * @code
+ * m_Publisher = CreateScope<StreamPublisher>(StreamPublisherSpecification{"tcp://0.0.0.0:5556"});
+ * m_Publisher->Start();
+ * @endcode
+ */
+class StreamPublisher {
+   public:
+    StreamPublisher(const StreamPublisherSpecification& spec);
+    ~StreamPublisher();
+
+    /**
+     * @brief Starts the encoder workers and attaches the readback to the Application.
+     */
+    void Start();
+
+    /**
+     * @brief Detaches the readback and joins the encoder workers.
+     */
+    void Stop();
+
+    void SetFrameRate(float fps);
+    inline void SetJpegQuality(int quality) { m_JpegQuality = quality; }
+
+    inline uint64_t GetPublishedCount() const { return m_PublishedCount; }
+    // Workers busy, or finished after a newer frame. Frames a slow subscriber misses at its
+    // high-water mark are dropped by ZMQ without telling the publisher, so they are not counted.
+    inline uint64_t GetDroppedCount() const { return m_DroppedCount; }
+
+   private:
+    struct Job {
+        cv::Mat Pixels;  // RGBA, bottom-up rows
+        uint64_t FrameIndex = 0;
+    };
+
+    void OnFrameReadBack(const uint8_t* pixels, uint32_t width, uint32_t height,
+                         uint64_t frameIndex);  // Render thread
+    void WorkerLoop();
+    void Publish(const std::vector<uchar>& jpeg, uint64_t frameIndex);
+
+    StreamPublisherSpecification m_Specification;
+    Ref<AsyncReadback> m_Readback;
+    std::atomic_int m_JpegQuality;
+
+    std::atomic_bool m_Running;
+    std::vector<std::thread> m_Workers;
+    std::deque<Job> m_Jobs;             // Waiting to be encoded
+    std::vector<cv::Mat> m_FreePixels;  // Recycled copy buffers
+    uint32_t m_JobsInFlight = 0;        // Queued or being encoded
+    std::mutex m_JobMutex;
+    std::condition_variable m_JobCondition;
+
+    zmq::context_t m_Context;
+    zmq::socket_t m_Publisher;
+    std::mutex m_PublisherMutex;  // ZMQ sockets are not thread safe
+    uint64_t m_LastPublishedIndex = 0;
+
+    std::atomic_uint64_t m_PublishedCount = 0;
+    std::atomic_uint64_t m_DroppedCount = 0;
+};
+
+}  // namespace ARcane
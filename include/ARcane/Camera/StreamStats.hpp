@@ -0,0 +1,119 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Core/Histogram.hpp"
+#include <array>
+#include <atomic>
+
+namespace ARcane {
+
+// Why a received frame never became the stream's current frame
+enum class FrameDropReason : uint32_t {
+    Lost = 0,            // Missing from the sequence numbers, never received
+    Skipped,             // Replaced by a newer frame before decoding, or overwritten in shm
+    RateLimited,         // DecodeSettings::MaxFrameRate
+    DecodeFailed,        // Corrupt or unsupported payload, decoder error
+    WaitingForKeyframe,  // Video frame after a gap, references pictures the decoder never saw
+    Count
+};
+
+const char* GetFrameDropReasonName(FrameDropReason reason);
+
+/**
+ * @class RateCounter
+ * @brief Lock-free events and bytes per second over the last few whole seconds.
+ *
+ * Counts go into one bucket per steady clock second, in a small ring. Add() is two relaxed atomic
+ * increments (plus a reset once per second); rates only include completed seconds, so they lag by
+ * up to a second but never read a bucket that is still filling. A bucket's Second is re-checked
+ * after its counts are read, so a reader racing the reset skips it rather than seeing it half
+ * cleared. Meant for one writing thread and any number of readers.
+ */
+class RateCounter {
+   public:
+    static constexpr uint32_t WindowSeconds = 4;
+
+    void Add(uint64_t nowNs, uint64_t bytes = 0);
+    // Per second, averaged over the last WindowSeconds complete seconds, or fewer right after
+    // the first event (0 until one complete second has passed)
+    double GetRate(uint64_t nowNs) const;
+    double GetByteRate(uint64_t nowNs) const;
+
+   private:
+    struct Bucket {
+        std::atomic_uint64_t Second = 0;
+        std::atomic_uint64_t Count = 0;
+        std::atomic_uint64_t Bytes = 0;
+    };
+
+    // Sums the complete seconds of the window; returns how many seconds that covers
+    uint64_t Sum(uint64_t nowNs, uint64_t& count, uint64_t& bytes) const;
+
+    // One extra bucket for the second being filled
+    std::array<Bucket, WindowSeconds + 1> m_Buckets;
+    std::atomic_uint64_t m_FirstSecond = 0;  // Of the first event, which only partly counts
+};
+
+/**
+ * @class StreamStats
+ * @brief Health counters of a CameraStream, updated lock-free by its receiving and decoding
+ * threads and readable from any thread.
+ */
+class StreamStats {
+   public:
+    // Consistent enough copy of the counters, for display and export
+    struct Snapshot {
+        uint64_t ReceivedCount = 0;
+        uint64_t DecodedCount = 0;
+        uint64_t ReceivedBytes = 0;
+        uint64_t TransportErrorCount = 0;  // ZMQ errors while receiving
+        std::array<uint64_t, (size_t)FrameDropReason::Count> DroppedCount = {};
+
+        double ReceiveFps = 0.0;
+        double DecodeFps = 0.0;
+        double Bitrate = 0.0;  // Received payload bits per second
+
+        // Time spent in the decoder per frame, in microseconds
+        uint64_t DecodeTimeP50Us = 0;
+        uint64_t DecodeTimeP99Us = 0;
+        uint64_t DecodeTimeMaxUs = 0;
+
+        // Since the last frame was received / decoded, -1 before the first one
+        double LastReceiveAgeMs = -1.0;
+        double LastDecodeAgeMs = -1.0;
+
+        uint64_t GetDroppedCount(FrameDropReason reason) const {
+            return DroppedCount[(size_t)reason];
+        }
+    };
+
+    // Times are steady clock (GetSteadyClockNs), a wall clock step would skew rates and ages
+    void RecordReceived(size_t bytes, uint64_t nowNs);
+    void RecordDecoded(uint64_t decodeTimeNs, uint64_t nowNs);
+    void RecordDropped(FrameDropReason reason, uint64_t count = 1);
+    void RecordTransportError();
+
+    inline uint64_t GetReceivedCount() const { return m_ReceivedCount.load(); }
+    inline uint64_t GetDroppedCount(FrameDropReason reason) const {
+        return m_DroppedCount[(size_t)reason].load();
+    }
+    inline const Histogram& GetDecodeTime() const { return m_DecodeTime; }
+
+    Snapshot GetSnapshot(uint64_t nowNs) const;
+
+   private:
+    std::atomic_uint64_t m_ReceivedCount = 0;
+    std::atomic_uint64_t m_DecodedCount = 0;
+    std::atomic_uint64_t m_ReceivedBytes = 0;
+    std::atomic_uint64_t m_TransportErrorCount = 0;
+    std::array<std::atomic_uint64_t, (size_t)FrameDropReason::Count> m_DroppedCount = {};
+
+    std::atomic_uint64_t m_LastReceiveNs = 0;
+    std::atomic_uint64_t m_LastDecodeNs = 0;
+
+    RateCounter m_ReceiveRate;
+    RateCounter m_DecodeRate;
+    Histogram m_DecodeTime;  // Microseconds
+};
+
+}  // namespace ARcane
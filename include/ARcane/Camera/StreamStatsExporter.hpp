@@ -0,0 +1,74 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Camera/CameraStream.hpp"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ARcane {
+
+/**
+ * @class StreamStatsExporter
+ * @brief Periodically appends the StreamStats of some CameraStreams to a JSON lines file.
+ *
+ * Every interval, a dedicated thread takes a snapshot of each stream and writes one line per
+ * stream, e.g.
+ * @code
+ * {"time_ns":...,"stream":"Front","received":1200,"decoded":1187,"receive_fps":30.0,...}
+ * @endcode
+ * The snapshots are lock-free, so exporting never slows down receiving, decoding or rendering.
+ * Streams must outlive the exporter, or be removed before they are destroyed.
+ */
+class StreamStatsExporter {
+   public:
+    /**
+     * @brief Opens the file for appending and starts the exporting thread.
+     * @param path JSON lines file, created if needed.
+     * @param interval Time between two exports.
+     */
+    StreamStatsExporter(const std::string& path,
+                        std::chrono::milliseconds interval = std::chrono::seconds(1));
+    ~StreamStatsExporter();
+
+    StreamStatsExporter(const StreamStatsExporter&) = delete;
+    StreamStatsExporter& operator=(const StreamStatsExporter&) = delete;
+
+    void AddStream(const std::string& name, const CameraStream& stream);
+    void RemoveStream(const CameraStream& stream);
+
+    // Writes the last export and closes the file
+    void Stop();
+
+    inline bool IsOpen() const { return m_File.is_open(); }
+    inline const std::string& GetPath() const { return m_Path; }
+    inline uint64_t GetExportCount() const { return m_ExportCount; }
+
+   private:
+    struct Entry {
+        std::string Name;
+        const CameraStream* Stream;
+    };
+
+    void ExportLoop();
+    void Export();  // Called with m_Mutex held
+
+    std::string m_Path;
+    std::ofstream m_File;
+    std::chrono::milliseconds m_Interval;
+
+    std::vector<Entry> m_Streams;  // Guarded by m_Mutex
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+
+    std::atomic_bool m_Running;
+    std::thread m_ExportThread;
+    std::atomic_uint64_t m_ExportCount = 0;
+};
+
+}  // namespace ARcane
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Camera/FrameHeader.hpp"
+#include "ARcane/Camera/SharedFrameRing.hpp"
+#include <opencv2/opencv.hpp>
+#include <zmq.hpp>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace ARcane {
+
+struct SyntheticPublisherSpecification {
+    std::string Url = "tcp://*:5556";  // tcp://, ipc://, inproc:// address to bind, or shm://name
+    uint32_t Width = 1280;
+    uint32_t Height = 720;
+    float FrameRate = 30.0f;     // Average frames per second
+    int JpegQuality = 80;        // 0-100
+    uint32_t BurstSize = 1;      // Frames sent back to back per burst, same average rate
+    uint32_t UniqueFrames = 60;  // Frames encoded up front and cycled through
+    uint64_t FrameCount = 0;     // Stop after this many frames (0 = until Stop())
+    bool SendHeader = true;      // Multipart with a FrameHeader, or bare JPEG messages
+    uint32_t CameraId = 0;
+
+    // JPEG, or H264/H265 when built with libavcodec (always sent with a header)
+    FrameEncoding Encoding = FrameEncoding::JPEG;
+    uint32_t VideoBitrate = 4'000'000;  // Bits per second
+    uint32_t KeyframeInterval = 30;     // Frames; the first unique frame is always a keyframe
+};
+
+/**
+ * @class SyntheticPublisher
+ * @brief Publishes generated JPEG, H.264 or H.265 frames for load and latency testing without a
+ * robot.
+ *
+ * A fixed set of frames (moving pattern with the frame number drawn in) is encoded once, so the
+ * publisher can sustain high rates and resolutions without competing with the subscriber for
+ * CPU. Video frames are encoded without B-frames and the sequence starts with a keyframe, so
+ * cycling through it stays decodable. Every message carries a sequence number and a wall clock
+ * send time, in a FrameHeader part, or in a JpegStamp comment segment for bare messages.
+ * CameraStream uses the sequence numbers to count lost frames and the send time as the capture
+ * time for latencies. Verify() decodes the frames back to check the encoding end to end.
+ *
+ * It runs in-process, or standalone through the arcane-synthetic-publisher tool. For inproc://
+ * the publisher has to share the subscriber's ZMQ context:
+ * @code
+ * SyntheticPublisherSpecification spec;
+ * spec.Url = "inproc://camera";
+ * m_Publisher = CreateScope<SyntheticPublisher>(spec, &m_Stream.GetContext());
+ * m_Publisher->Start();
+ * m_Stream.StartSubscriberThread("inproc://camera");
+ * @endcode
+ */
+class SyntheticPublisher {
+   public:
+    /**
+     * @param spec Stream parameters.
+     * @param context Context to create the socket in (required for inproc://), or nullptr to
+     * use an internal one.
+     */
+    SyntheticPublisher(const SyntheticPublisherSpecification& spec,
+                       zmq::context_t* context = nullptr);
+    ~SyntheticPublisher();
+
+    void Start();
+    void Stop();
+
+    inline bool IsRunning() const { return m_Running; }
+    inline uint64_t GetSentCount() const { return m_SentCount; }
+    inline uint64_t GetBytesSent() const { return m_BytesSent; }
+
+    /**
+     * @brief Decodes every generated frame with the decoders CameraStream uses and compares it
+     * with the frame before encoding, without publishing anything.
+     * @return False if a frame does not decode, has the wrong size or differs too much.
+     */
+    bool Verify() const;
+
+   private:
+    void GenerateFrames();
+    void DrawFrame(cv::Mat& image, uint32_t index) const;
+    bool EncodeVideo();
+    void PublishLoop();
+
+    SyntheticPublisherSpecification m_Specification;
+    std::vector<std::vector<uchar>> m_Frames;  // Encoded, JPEGs with a blank stamp after the SOI
+    std::vector<bool> m_Keyframes;             // Per frame, all true for JPEG
+
+    Scope<zmq::context_t> m_OwnedContext;
+    zmq::socket_t m_Publisher;
+    Scope<SharedFrameWriter> m_SharedWriter;  // Instead of the socket for shm:// URLs
+    static constexpr uint32_t SharedRingSlotCount = 8;
+    static constexpr double MaxVerifyError = 8.0;  // Mean absolute error per 8 bit sample
+
+    std::atomic_bool m_Running;
+    std::thread m_PublishThread;
+
+    std::atomic_uint64_t m_SentCount = 0;
+    std::atomic_uint64_t m_BytesSent = 0;
+};
+
+}  // namespace ARcane
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Camera/FrameHeader.hpp"
+#include <opencv2/opencv.hpp>
+
+struct AVCodecContext;
+struct AVPacket;
+struct AVFrame;
+
+namespace ARcane {
+
+struct VideoDecoderSettings {
+    uint32_t ThreadCount = 0;  // 0 = one per core
+
+    // Low delay: slice threads and AV_CODEC_FLAG_LOW_DELAY, every access unit comes out as soon
+    // as it is decoded. Otherwise frame threads, which scale better with resolution but hold
+    // back ThreadCount - 1 frames. libavcodec never combines frame threads with low delay.
+    bool LowDelay = true;
+};
+
+/**
+ * @class VideoDecoder
+ * @brief Software H.264/H.265 decoder (libavcodec) for inter-frame coded camera streams.
+ *
+ * Unlike a FrameDecoder, a VideoDecoder keeps state between frames: every access unit has to be
+ * decoded in order, starting from a keyframe. Decoded frames are handed out in their native
+ * planar layout (FramePixelFormat::I420), so the only CPU work after decoding is a copy of the
+ * planes; the conversion to RGB happens in the camera shader.
+ *
+ * Only available when ARC_HAS_LIBAV is defined; Create() returns nullptr otherwise. An instance
+ * is not thread safe.
+ */
+class VideoDecoder {
+   public:
+    ~VideoDecoder();
+
+    /**
+     * @brief Creates a decoder for an inter-frame encoding.
+     * @return nullptr if libavcodec is missing or was built without the codec.
+     */
+    static Scope<VideoDecoder> Create(FrameEncoding encoding,
+                                      const VideoDecoderSettings& settings = {});
+
+    const char* GetName() const;
+
+    /**
+     * @brief Decodes one access unit.
+     * @param output Receives the newest decoded frame as I420: a single channel matrix with the
+     * Y rows followed by the U and V planes. Its memory is reused when the size does not change.
+     * @return True if a frame came out. False is not an error while frame threads fill up.
+     */
+    bool Decode(const void* data, size_t size, cv::Mat& output);
+
+    // Drops the frames held back by the decoder, e.g. before seeking to the next keyframe
+    void Flush();
+
+    // Packets rejected and frames that failed to decode or were in an unsupported format. Tells
+    // a failed Decode() apart from one that simply has no output yet.
+    inline uint64_t GetErrorCount() const { return m_ErrorCount; }
+
+   private:
+    VideoDecoder() = default;
+    // Takes every frame the decoder has ready, keeping the newest; true if one was copied
+    bool ReceiveFrames(cv::Mat& output);
+    bool CopyFrame(cv::Mat& output);
+
+    AVCodecContext* m_Context = nullptr;
+    AVPacket* m_Packet = nullptr;
+    AVFrame* m_Frame = nullptr;
+    std::vector<uint8_t> m_PacketBuffer;  // Payload plus the padding libavcodec reads past it
+    bool m_FormatWarned = false;
+    uint64_t m_ErrorCount = 0;
+};
+
+}  // namespace ARcane
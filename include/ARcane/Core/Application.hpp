@@ -9,6 +9,8 @@
 #include "ARcane/Core/Timestep.hpp"
 #include "ARcane/Renderer/Renderer.hpp"
 #include "ARcane/Renderer/Renderer2D.hpp"
+#include "ARcane/Renderer/Framebuffer.hpp"
+#include "ARcane/Renderer/AsyncReadback.hpp"
 
 namespace ARcane {
 
@@ -18,13 +20,18 @@ namespace ARcane {
  *
  * This class is responsible for initializing and running the engine, handling events,
  * and managing layers. It should be inherited by the client application.
+ *
+ * In Hidden and Headless mode the layer stack renders into an offscreen Framebuffer instead of
+ * the window. The mode can also be forced with the ARCANE_WINDOW_MODE environment variable
+ * ("windowed", "hidden" or "headless"), e.g. to run an unmodified application in CI.
  */
 class Application {
    public:
     /**
      * @brief Constructs the application.
+     * @param mode Window mode, overridden by ARCANE_WINDOW_MODE if set.
      */
-    Application();
+    Application(WindowMode mode = WindowMode::Windowed);
 
     /**
      * @brief Destroys the application and cleans up resources.
@@ -38,6 +45,13 @@ class Application {
      */
     void Run();
 
+    /**
+     * @brief Stops the main loop after the current frame.
+     *
+     * Headless applications have no window to close, so they must call this to exit.
+     */
+    void Close();
+
     /**
      * @brief Handles incoming events.
      * @param e The event to process.
@@ -56,6 +70,20 @@ class Application {
      */
     void PushOverlay(Layer* overlay);
 
+    /**
+     * @brief Reads back every composed frame (scene plus ImGui) through an AsyncReadback.
+     *
+     * The readback is captured and polled once per frame, right before the buffers are swapped.
+     * @param readback The readback to drive.
+     */
+    void AttachReadback(const Ref<AsyncReadback>& readback);
+
+    /**
+     * @brief Stops driving a readback attached with AttachReadback().
+     * @param readback The readback to remove.
+     */
+    void DetachReadback(const Ref<AsyncReadback>& readback);
+
     /**
      * @brief Gets the reference to application instance.
      * @return Reference to the application instance.
@@ -68,6 +96,18 @@ class Application {
      */
     inline Window& GetWindow() { return *m_Window; }
 
+    /**
+     * @brief Gets the engine's ImGui overlay.
+     * @return Pointer to the ImGui layer.
+     */
+    inline ImGuiLayer* GetImGuiLayer() { return m_ImGuiLayer; }
+
+    /**
+     * @brief Gets the offscreen render target used in Hidden and Headless mode.
+     * @return The framebuffer, or nullptr when rendering to the window.
+     */
+    inline const Ref<Framebuffer>& GetFramebuffer() const { return m_Framebuffer; }
+
    private:
     /**
      * @brief Handles window close events.
@@ -82,6 +122,8 @@ class Application {
     ImGuiLayer* m_ImGuiLayer = nullptr;  // ImGui layer instance.
     LayerStack m_LayerStack;             // Manages layers within the application.
     Scope<Window> m_Window;              // Application window instance.
+    Ref<Framebuffer> m_Framebuffer;      // Offscreen target when not windowed.
+    std::vector<Ref<AsyncReadback>> m_Readbacks;  // Fed with every composed frame.
     float m_LastFrameTime = 0.0f;        // Time of the last frame.
 
     static Application* s_Instance;  // Pointer to the application instance (singleton).
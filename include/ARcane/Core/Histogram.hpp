@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace ARcane {
+
+/**
+ * @class Histogram
+ * @brief Lock-free histogram of non-negative integer samples with log-linear buckets.
+ *
+ * Every power of two is split into 16 buckets, so percentiles are accurate to about 6% over the
+ * whole 64-bit range with a fixed 8 KB footprint. Record() is a few relaxed atomic increments and
+ * can be called from any number of threads while another thread reads percentiles.
+ */
+class Histogram {
+   public:
+    Histogram();
+
+    void Record(uint64_t value);
+
+    /**
+     * @brief Clears all samples. Samples recorded concurrently may be partially kept.
+     */
+    void Reset();
+
+    inline uint64_t GetCount() const { return m_Count.load(std::memory_order_relaxed); }
+    inline uint64_t GetMax() const { return m_Max.load(std::memory_order_relaxed); }
+    double GetMean() const;
+
+    /**
+     * @brief Gets the value below which a given share of the samples fall.
+     * @param percentile Between 0 and 100, e.g. 99 for p99.
+     * @return Upper bound of the bucket holding the percentile (0 if there are no samples).
+     */
+    uint64_t GetPercentile(double percentile) const;
+
+   private:
+    static constexpr uint32_t SubBucketBits = 4;
+    static constexpr uint32_t SubBucketCount = 1 << SubBucketBits;
+    static constexpr uint32_t BucketCount = (64 - SubBucketBits + 1) * SubBucketCount;
+
+    static uint32_t GetBucketIndex(uint64_t value);
+    static uint64_t GetBucketUpperBound(uint32_t index);
+
+    std::array<std::atomic_uint64_t, BucketCount> m_Buckets;
+    std::atomic_uint64_t m_Count;
+    std::atomic_uint64_t m_Sum;
+    std::atomic_uint64_t m_Max;
+};
+
+}  // namespace ARcane
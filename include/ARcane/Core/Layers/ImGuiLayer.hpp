@@ -5,6 +5,7 @@
 #include "ARcane/Core/Events/MouseEvent.hpp"
 #include "ARcane/Core/Events/KeyEvent.hpp"
 #include "ARcane/Core/Events/ApplicationEvent.hpp"
+#include "ARcane/Renderer/GPUTimer.hpp"
 
 namespace ARcane {
 
@@ -19,6 +20,12 @@ class ImGuiLayer : public Layer {
 
     void Begin();
     void End();
+
+    // GPU time spent rendering the ImGui draw data (resolved a few frames late)
+    inline float GetGPUTimeMs() const { return m_GPUTimer ? m_GPUTimer->GetElapsedMs() : 0.0f; }
+
+   private:
+    Scope<GPUTimer> m_GPUTimer;
 };
 
 }  // namespace ARcane
\ No newline at end of file
@@ -56,6 +56,11 @@ class LayerStack {
      */
     void PopOverlay(Layer* overlay);
 
+    /**
+     * @brief Detaches and deletes every layer, overlays first (the reverse of the stack order).
+     */
+    void Clear();
+
     /**
      * @brief Returns an iterator to the beginning of the layer stack.
      *
@@ -27,6 +27,16 @@ struct WindowUserStruct {
         : Width(width), Height(height), Title(title) {}
 };
 
+/**
+ * @enum WindowMode
+ * @brief How the window and its OpenGL context are created.
+ */
+enum class WindowMode {
+    Windowed,  // Regular visible window
+    Hidden,    // Invisible window, still needs a display server
+    Headless   // No display at all: GLFW null platform with a surfaceless EGL context
+};
+
 /**
  * @class Window
  * @brief Internal class for window management.
@@ -43,8 +53,10 @@ class Window {
      * @param width Window width in pixels.
      * @param height Window height in pixels.
      * @param title Window title.
+     * @param mode Whether the window is visible, hidden or has no display at all.
      */
-    Window(uint32_t width, uint32_t height, const char* title);
+    Window(uint32_t width, uint32_t height, const char* title,
+           WindowMode mode = WindowMode::Windowed);
 
     /**
      * @brief Destroys the window and cleans up resources.
@@ -68,6 +80,12 @@ class Window {
      */
     inline uint32_t GetHeight() const { return m_UserStruct.Height; }
 
+    /**
+     * @brief Gets the mode the window was created with.
+     * @return The window mode.
+     */
+    inline WindowMode GetMode() const { return m_Mode; }
+
     /**
      * @brief Sets the event callback function for handling window events.
      * @param callback Function to be called when an event occurs.
@@ -86,6 +104,7 @@ class Window {
     GLFWwindow* m_Window = nullptr;  // Native window handle
     GraphicsContext* m_Context;      // Graphics context for rendering
     WindowUserStruct m_UserStruct;   // Stores window properties and callbacks
+    WindowMode m_Mode;               // Visible, hidden or headless
 
     /**
      * @brief Sets GLFW event callbacks for handling input and window events.
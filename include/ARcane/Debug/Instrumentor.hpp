@@ -2,84 +2,207 @@
 
 #include <string>
 #include <chrono>
-#include <algorithm>
+#include <atomic>
+#include <array>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <vector>
 #include <fstream>
 
 #include <thread>
 
 namespace ARcane {
-struct ProfileResult {
-    std::string Name;
-    long long Start, End;
-    uint32_t ThreadID;
-};
 
-struct InstrumentationSession {
-    std::string Name;
+// Continuous recording for Instrumentor::StartFlightRecorder()
+struct FlightRecorderSettings {
+    float FrameBudgetMs = 33.3f;           // Frames longer than this trigger a dump
+    float DurationSeconds = 5.0f;          // Time before the slow frame included in a dump
+    float MinDumpIntervalSeconds = 30.0f;  // Slow frames closer than this to a dump are ignored
+    uint32_t MaxDumps = 10;                // Per run, so a slow machine cannot fill the disk
+    std::string Directory = ".";           // Where the ARcaneFlight-*.json files go
 };
 
-class Instrumentor {
-   private:
-    InstrumentationSession* m_CurrentSession;
-    std::ofstream m_OutputStream;
-    int m_ProfileCount;
-
+/**
+ * @class ProfileThreadBuffer
+ * @brief Ring of raw profile events written by one thread and read by the Instrumentor.
+ *
+ * Push() is a release fence, three relaxed stores and a release store of the head; it never
+ * locks, allocates or waits. The reader keeps its own cursor: if it falls more than a ring behind,
+ * the oldest events are overwritten and counted as lost rather than slowing the instrumented
+ * thread down. As in a seqlock, the reader copies the slots and then re-checks the head to drop
+ * any it may have read mid-overwrite.
+ */
+class ProfileThreadBuffer {
    public:
-    Instrumentor() : m_CurrentSession(nullptr), m_ProfileCount(0) {}
-
-    void BeginSession(const std::string& name, const std::string& filepath = "results.json") {
-        m_OutputStream.open(filepath);
-        WriteHeader();
-        m_CurrentSession = new InstrumentationSession{name};
+    static constexpr uint32_t Capacity = 65536;  // Power of two, 1.5 MB per thread
+
+    // Raw record: formatting happens on the writer thread
+    struct Event {
+        std::atomic<const char*> Name{nullptr};  // Static string: literal or __PRETTY_FUNCTION__
+        std::atomic_uint64_t StartNs{0};
+        std::atomic_uint64_t EndNs{0};
+    };
+
+    // Copy of an event taken by the reader
+    struct Record {
+        const char* Name;
+        uint64_t StartNs;
+        uint64_t EndNs;
+    };
+
+    ProfileThreadBuffer(uint32_t threadID) : m_ThreadID(threadID) {}
+
+    inline void Push(const char* name, uint64_t startNs, uint64_t endNs) {
+        uint64_t head = m_Head.load(std::memory_order_relaxed);
+        Event& event = m_Events[head & (Capacity - 1)];
+        // Orders the previous head store before the slot stores: a reader that sees any of them
+        // is guaranteed to see this head when it re-checks, and discards the slot
+        std::atomic_thread_fence(std::memory_order_release);
+        event.Name.store(name, std::memory_order_relaxed);
+        event.StartNs.store(startNs, std::memory_order_relaxed);
+        event.EndNs.store(endNs, std::memory_order_relaxed);
+        m_Head.store(head + 1, std::memory_order_release);
     }
 
-    void EndSession() {
-        WriteFooter();
-        m_OutputStream.close();
-        delete m_CurrentSession;
-        m_CurrentSession = nullptr;
-        m_ProfileCount = 0;
-    }
+    // Copies the events pushed since the cursor and advances it; returns the number of events
+    // that were overwritten before they could be read
+    uint64_t Read(uint64_t& cursor, std::vector<Record>& records) const;
 
-    void WriteProfile(const ProfileResult& result) {
-        if (m_ProfileCount++ > 0) m_OutputStream << ",";
+    inline uint64_t GetHead() const { return m_Head.load(std::memory_order_acquire); }
+    // End time of the newest event, 0 if none
+    uint64_t GetLastEndNs() const;
+    inline uint32_t GetThreadID() const { return m_ThreadID; }
 
-        std::string name = result.Name;
-        std::replace(name.begin(), name.end(), '"', '\'');
+    // Set when the owning thread exits; the buffer is released once it has been read
+    std::atomic_bool Finished = false;
 
-        m_OutputStream << "{";
-        m_OutputStream << "\"cat\":\"function\",";
-        m_OutputStream << "\"dur\":" << (result.End - result.Start) << ',';
-        m_OutputStream << "\"name\":\"" << name << "\",";
-        m_OutputStream << "\"ph\":\"X\",";
-        m_OutputStream << "\"pid\":0,";
-        m_OutputStream << "\"tid\":" << result.ThreadID << ",";
-        m_OutputStream << "\"ts\":" << result.Start;
-        m_OutputStream << "}";
+   private:
+    uint32_t m_ThreadID;
+    std::atomic_uint64_t m_Head = 0;
+    std::array<Event, Capacity> m_Events;
+};
 
-        m_OutputStream.flush();
+/**
+ * @class Instrumentor
+ * @brief Records ARC_PROFILE_SCOPE timings into a Chrome trace file (chrome://tracing, Perfetto).
+ *
+ * Instrumented threads only push raw records (name pointer, start and end time) into their own
+ * ProfileThreadBuffer, registered on the thread's first event. A background writer thread drains
+ * every buffer a few times per second, formats the JSON and writes it in large blocks, so neither
+ * formatting nor file I/O happens on the profiled threads and any number of threads can record at
+ * once. Scope names are stored as pointers and must outlive the session.
+ *
+ * The flight recorder keeps scopes recording into the same rings without any session: nothing is
+ * written until a frame marked with ARC_PROFILE_FRAME() exceeds the budget, then the writer
+ * thread dumps the last seconds of every thread to a trace file of its own. The rings hold the
+ * last 65536 scopes of each thread, which bounds how far back a busy thread goes.
+ *
+ * Live readers such as ProfilerPanel also keep scopes recording, and read the thread buffers
+ * directly with cursors of their own.
+ */
+class Instrumentor {
+   public:
+    ~Instrumentor();
+
+    void BeginSession(const std::string& name, const std::string& filepath = "results.json");
+    // Writes the remaining events, then closes the file
+    void EndSession();
+
+    // Call from the thread marking frames. Can run alongside a session.
+    void StartFlightRecorder(const FlightRecorderSettings& settings = FlightRecorderSettings());
+    void StopFlightRecorder();
+    inline bool IsFlightRecorderActive() const { return m_FlightRecorderActive; }
+    inline uint32_t GetFlightDumpCount() const { return m_DumpCount; }
+
+    // Ends a frame started by the previous call: records it as a FrameScopeName scope and checks
+    // it against the flight recorder budget. Call once per frame, from one thread.
+    void MarkFrame();
+    static constexpr const char* FrameScopeName = "Frame";
+
+    // Counted: scopes keep recording while at least one live reader is active
+    void BeginLiveCapture();
+    void EndLiveCapture();
+    // Every thread that recorded, until a while after it exits. For live readers: the list is
+    // only copied if it changed since the version passed in, which is then updated.
+    bool GetThreadBuffers(std::vector<std::shared_ptr<ProfileThreadBuffer>>& buffers,
+                          uint64_t& version);
+
+    inline void Record(const char* name, uint64_t startNs, uint64_t endNs) {
+        if (!m_Recording.load(std::memory_order_relaxed)) return;
+        ProfileThreadBuffer* buffer = s_ThreadBuffer ? s_ThreadBuffer : RegisterThread();
+        buffer->Push(name, startNs, endNs);
     }
 
-    void WriteHeader() {
-        m_OutputStream << "{\"otherData\": {},\"traceEvents\":[";
-        m_OutputStream.flush();
-    }
+    // Events overwritten before the writer thread reached them, in the current session
+    inline uint64_t GetLostCount() const { return m_LostCount.load(); }
 
-    void WriteFooter() {
-        m_OutputStream << "]}";
-        m_OutputStream.flush();
+    // Monotonic time the events are stamped with
+    static inline uint64_t Now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
     }
 
     static Instrumentor& Get() {
         static Instrumentor instance;
         return instance;
     }
+
+   private:
+    struct ThreadEntry {
+        std::shared_ptr<ProfileThreadBuffer> Buffer;
+        uint64_t Cursor = 0;  // Next event the writer reads
+    };
+    struct ThreadOwner;  // Marks the buffer of an exiting thread as finished
+
+    ProfileThreadBuffer* RegisterThread();
+    // Called with m_Mutex held
+    void StartWriter();
+    void AdoptNewThreads();
+    void WriterLoop();
+    void Drain();
+    void WriteFlightDump(uint64_t triggerNs, uint64_t frameNs);
+    void PruneThreads();
+    void UpdateRecording();
+
+    static thread_local ProfileThreadBuffer* s_ThreadBuffer;
+
+    std::atomic_bool m_Recording = false;  // Session, flight recorder or live reader active
+    std::atomic_bool m_SessionActive = false;
+    std::atomic_bool m_FlightRecorderActive = false;
+    uint32_t m_LiveCaptureCount = 0;
+    std::mutex m_Mutex;  // Guards everything the writer thread touches
+    std::condition_variable m_Condition;
+    std::thread m_WriterThread;  // Started with the first session or flight recorder
+    bool m_StopWriter = false;
+
+    std::vector<ThreadEntry> m_Threads;
+    std::vector<std::shared_ptr<ProfileThreadBuffer>> m_NewThreads;  // Guarded by m_ThreadsMutex
+    std::vector<std::shared_ptr<ProfileThreadBuffer>> m_Buffers;     // Guarded by m_ThreadsMutex
+    uint64_t m_BuffersVersion = 1;  // Guarded by m_ThreadsMutex, changes with m_Buffers
+    std::mutex m_ThreadsMutex;
+    uint32_t m_NextThreadID = 1;  // Guarded by m_ThreadsMutex
+
+    std::ofstream m_OutputStream;
+    std::string m_Block;  // Formatted JSON waiting to be written
+    std::vector<ProfileThreadBuffer::Record> m_Records;
+    uint64_t m_SessionStartNs = 0;
+    uint64_t m_EventCount = 0;
+    std::atomic_uint64_t m_LostCount = 0;
+
+    FlightRecorderSettings m_FlightSettings;
+    uint64_t m_LastFrameNs = 0;  // Thread marking frames only
+    uint64_t m_LastDumpNs = 0;   // Thread marking frames only
+    std::atomic_uint32_t m_DumpCount = 0;
+    std::atomic_uint64_t m_DumpTriggerNs = 0;  // End of the slow frame, 0 = no dump requested
+    std::atomic_uint64_t m_DumpFrameNs = 0;
 };
 
 class InstrumentationTimer {
    public:
     InstrumentationTimer(const char* name) : m_Name(name), m_Stopped(false) {
-        m_StartTimepoint = std::chrono::high_resolution_clock::now();
+        m_StartNs = Instrumentor::Now();
     }
 
     ~InstrumentationTimer() {
@@ -87,24 +210,13 @@ class InstrumentationTimer {
     }
 
     void Stop() {
-        auto endTimepoint = std::chrono::high_resolution_clock::now();
-
-        long long start = std::chrono::time_point_cast<std::chrono::microseconds>(m_StartTimepoint)
-                              .time_since_epoch()
-                              .count();
-        long long end = std::chrono::time_point_cast<std::chrono::microseconds>(endTimepoint)
-                            .time_since_epoch()
-                            .count();
-
-        uint32_t threadID = std::hash<std::thread::id>{}(std::this_thread::get_id());
-        Instrumentor::Get().WriteProfile({m_Name, start, end, threadID});
-
+        Instrumentor::Get().Record(m_Name, m_StartNs, Instrumentor::Now());
         m_Stopped = true;
     }
 
    private:
     const char* m_Name;
-    std::chrono::time_point<std::chrono::high_resolution_clock> m_StartTimepoint;
+    uint64_t m_StartNs;
     bool m_Stopped;
 };
 }  // namespace ARcane
@@ -120,9 +232,11 @@ class InstrumentationTimer {
 #define ARC_PROFILE_END_SESSION() ::ARcane::Instrumentor::Get().EndSession()
 #define ARC_PROFILE_SCOPE(name) ::ARcane::InstrumentationTimer TOKENPASTE2(timer, __LINE__)(name)
 #define ARC_PROFILE_FUNCTION() ARC_PROFILE_SCOPE(__PRETTY_FUNCTION__)
+#define ARC_PROFILE_FRAME() ::ARcane::Instrumentor::Get().MarkFrame()
 #else
 #define ARC_PROFILE_BEGIN_SESSION(name, filepath)
 #define ARC_PROFILE_END_SESSION()
 #define ARC_PROFILE_SCOPE(name)
 #define ARC_PROFILE_FUNCTION()
+#define ARC_PROFILE_FRAME()
 #endif
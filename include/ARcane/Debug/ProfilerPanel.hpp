@@ -0,0 +1,104 @@
+#pragma once
+
+#include "ARcane/Core/Layers/Layer.hpp"
+#include "ARcane/Core/Histogram.hpp"
+#include "ARcane/Debug/Instrumentor.hpp"
+
+#include <array>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ARcane {
+
+/**
+ * @class ProfilerPanel
+ * @brief Live ImGui profiler fed by the ARC_PROFILE_SCOPE instrumentation.
+ *
+ * Shows the frame times of the last frames against a budget, a timeline of every thread's
+ * scopes over the last few frames (nested scopes stacked below their parent), and per-scope
+ * call counts and min/avg/p99/max times over a rolling window of a couple of seconds.
+ *
+ * While attached, the panel keeps the Instrumentor recording and reads the per-thread buffers
+ * once per frame with cursors of its own; aggregating is a hash lookup per scope, so it can stay
+ * open on a running robot. Frames are delimited by ARC_PROFILE_FRAME(), which Application::Run()
+ * calls. Clicking the frame graph pauses the timeline on the frame under the mouse; while paused,
+ * the graph and timeline are frozen but the statistics keep updating.
+ *
+ * Example usage:
+ * @code
+ * PushOverlay(new ARcane::ProfilerPanel());
+ * @endcode
+ */
+class ProfilerPanel : public Layer {
+   public:
+    ProfilerPanel();
+
+    void OnAttach() override;
+    void OnDetach() override;
+    void OnImGuiRender() override;
+
+   private:
+    static constexpr uint32_t HistorySize = 240;  // Frames kept for the frame time graph
+    static constexpr uint32_t MaxTimelineFrames = 30;
+    static constexpr uint64_t StatsWindowNs = 2'000'000'000;
+
+    // A recorded scope kept for the timeline
+    struct Span {
+        const char* Name;
+        uint64_t StartNs;
+        uint64_t EndNs;
+    };
+
+    struct Track {
+        std::shared_ptr<ProfileThreadBuffer> Buffer;
+        uint64_t Cursor = 0;
+        std::deque<Span> Spans;  // Ordered by end time, back to the oldest frame of m_Frames
+        bool Registered = true;  // Still listed by the Instrumentor
+    };
+
+    struct Frame {
+        uint64_t StartNs;
+        uint64_t EndNs;
+    };
+
+    // Accumulated over the current window
+    struct ScopeStats {
+        uint64_t Calls = 0;
+        uint64_t MinNs = UINT64_MAX;
+        Histogram Durations;  // Nanoseconds
+    };
+
+    // Published at the end of each window
+    struct ScopeSummary {
+        const char* Name;
+        double CallsPerFrame;
+        float MinMs, AvgMs, P99Ms, MaxMs;
+    };
+
+    void Collect();
+    void PublishStats(uint64_t nowNs);
+
+    void DrawFrameGraph();
+    void DrawTimeline();
+    void DrawScopeTable();
+
+    std::vector<std::shared_ptr<ProfileThreadBuffer>> m_Buffers;
+    uint64_t m_BuffersVersion = 0;
+    std::vector<Track> m_Tracks;
+    std::vector<ProfileThreadBuffer::Record> m_Records;
+
+    std::deque<Frame> m_Frames;  // Up to HistorySize, oldest first
+
+    std::unordered_map<const char*, ScopeStats> m_Stats;
+    std::vector<ScopeSummary> m_Summary;
+    uint64_t m_WindowStartNs = 0;
+    uint64_t m_WindowFrameCount = 0;
+
+    float m_BudgetMs = 16.7f;
+    int m_TimelineFrames = 3;
+    bool m_Paused = false;
+    uint64_t m_SelectedFrameEndNs = 0;  // Last frame of the timeline while paused
+};
+
+}  // namespace ARcane
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "ARcane/Core/Layers/Layer.hpp"
+
+#include <array>
+
+namespace ARcane {
+
+/**
+ * @class RendererStatsPanel
+ * @brief Ready-made ImGui overlay that plots the Renderer2D statistics over the last frames.
+ *
+ * Shows CPU frame time, GPU time of the scene and ImGui passes, bytes uploaded per frame,
+ * draw calls, texture binds, culled quads and why each batch was flushed.
+ *
+ * Example usage:
+ * @code
+ * PushOverlay(new ARcane::RendererStatsPanel());
+ * @endcode
+ */
+class RendererStatsPanel : public Layer {
+   public:
+    RendererStatsPanel();
+
+    void OnUpdate(Timestep ts) override;
+    void OnImGuiRender() override;
+
+   private:
+    static constexpr uint32_t HistorySize = 240;  // Frames kept for the plots
+
+    // Fixed-size ring of samples that ImGui::PlotLines can read with an offset
+    struct History {
+        std::array<float, HistorySize> Values = {};
+        float Max = 0.0f;
+
+        void Push(float value, uint32_t offset);
+    };
+
+    uint32_t m_Offset = 0;  // Index of the oldest sample in every history ring
+    float m_FrameTimeMs = 0.0f;
+
+    History m_FrameTime;
+    History m_SceneGPUTime;
+    History m_ImGuiGPUTime;
+    History m_VertexKB;
+    History m_TextureKB;
+    History m_DrawCalls;
+};
+
+}  // namespace ARcane
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "ARcane/Core/Layers/Layer.hpp"
+#include "ARcane/Camera/SessionPlayer.hpp"
+
+namespace ARcane {
+
+/**
+ * @class SessionTimelinePanel
+ * @brief ImGui transport controls and timeline scrubber for a SessionPlayer.
+ *
+ * Dragging the timeline seeks on every frame; the player decodes in the background, so the UI
+ * keeps its frame rate however fast the slider moves.
+ *
+ * Example usage:
+ * @code
+ * PushOverlay(new ARcane::SessionTimelinePanel(player));
+ * @endcode
+ */
+class SessionTimelinePanel : public Layer {
+   public:
+    SessionTimelinePanel(const Ref<SessionPlayer>& player);
+
+    void OnUpdate(Timestep ts) override;
+    void OnImGuiRender() override;
+
+   private:
+    Ref<SessionPlayer> m_Player;
+};
+
+}  // namespace ARcane
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "ARcane/Core/Layers/Layer.hpp"
+#include "ARcane/Camera/CameraStream.hpp"
+
+#include <string>
+#include <vector>
+
+namespace ARcane {
+
+/**
+ * @class StreamStatsPanel
+ * @brief Ready-made ImGui overlay with the health of one or more CameraStreams.
+ *
+ * One table row per stream: receive and decode rates, bitrate, decode time percentiles, age of
+ * the last received frame, drops by reason and transport errors. Streams that stopped receiving
+ * for over a second are highlighted. Hovering a row shows the frame pacing statistics.
+ *
+ * Everything is read from the lock-free StreamStats of each stream, so the panel never waits on
+ * a receiving thread. Streams must outlive the panel.
+ *
+ * Example usage:
+ * @code
+ * auto* panel = new ARcane::StreamStatsPanel();
+ * panel->AddStream("Front", frontStream);
+ * PushOverlay(panel);
+ * @endcode
+ */
+class StreamStatsPanel : public Layer {
+   public:
+    StreamStatsPanel();
+
+    void AddStream(const std::string& name, const CameraStream& stream);
+    void RemoveStream(const CameraStream& stream);
+
+    void OnImGuiRender() override;
+
+   private:
+    struct Entry {
+        std::string Name;
+        const CameraStream* Stream;
+    };
+
+    std::vector<Entry> m_Streams;
+};
+
+}  // namespace ARcane
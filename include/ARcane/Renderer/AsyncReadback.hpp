@@ -0,0 +1,98 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Renderer/Framebuffer.hpp"
+
+#include <glad/glad.h>
+#include <chrono>
+
+namespace ARcane {
+
+/**
+ * @class AsyncReadback
+ * @brief Reads rendered frames back to the CPU without stalling the GPU.
+ *
+ * Capture() queues a glReadPixels into one of a ring of pixel pack buffers and inserts a fence.
+ * Poll() checks the fences without waiting and hands every finished frame to the callback,
+ * usually one or two frames after it was captured. If all buffers are still in flight the
+ * capture is dropped instead of blocking the render loop.
+ *
+ * Pixels are RGBA8 with rows bottom-up (OpenGL order) and are only valid during the callback.
+ *
+ * Example usage:
+ * @code
+ * auto readback = CreateRef<AsyncReadback>();
+ * readback->SetCallback([](const uint8_t* pixels, uint32_t w, uint32_t h, uint64_t frame) {
+ *     // copy or consume the pixels here
+ * });
+ * Application::Get().AttachReadback(readback);  // Captured and polled every frame
+ * @endcode
+ */
+class AsyncReadback {
+   public:
+    using Callback = std::function<void(const uint8_t* pixels, uint32_t width, uint32_t height,
+                                        uint64_t frameIndex)>;
+
+    /**
+     * @brief Creates the pixel pack buffer ring.
+     * @param ringSize Number of reads that may be in flight at once.
+     */
+    AsyncReadback(uint32_t ringSize = 3);
+    ~AsyncReadback();
+
+    /**
+     * @brief Sets the function that receives finished frames (called from Poll()).
+     */
+    inline void SetCallback(const Callback& callback) { m_Callback = callback; }
+
+    /**
+     * @brief Limits how often Capture() actually reads (0 = every call).
+     * @param fps Maximum captures per second.
+     */
+    void SetMaxFrameRate(float fps);
+
+    /**
+     * @brief Queues a read of the currently bound read framebuffer.
+     * @return False if the read was skipped (rate limit or all buffers in flight).
+     */
+    bool Capture(uint32_t width, uint32_t height);
+
+    /**
+     * @brief Queues a read of a framebuffer's resolved color attachment.
+     * @return False if the read was skipped (rate limit or all buffers in flight).
+     */
+    bool Capture(const Framebuffer& framebuffer);
+
+    /**
+     * @brief Delivers every read whose fence has signaled. Never waits.
+     * @return Number of frames delivered.
+     */
+    uint32_t Poll();
+
+    /**
+     * @brief Gets the number of captures dropped because all buffers were in flight.
+     */
+    inline uint64_t GetDroppedCount() const { return m_DroppedCount; }
+
+   private:
+    struct Slot {
+        uint32_t Buffer = 0;     // Pixel pack buffer
+        GLsync Fence = nullptr;  // Non-null while the read is in flight
+        uint32_t Width = 0, Height = 0;
+        uint32_t Capacity = 0;  // Allocated size of the buffer in bytes
+        uint64_t FrameIndex = 0;
+    };
+
+    std::vector<Slot> m_Slots;
+    uint32_t m_Head = 0;  // Next slot to capture into
+    uint32_t m_Tail = 0;  // Oldest slot in flight
+    Callback m_Callback;
+
+    std::chrono::steady_clock::duration m_MinInterval{0};
+    std::chrono::steady_clock::time_point m_LastCapture;
+
+    uint64_t m_FrameIndex = 0;
+    uint64_t m_DroppedCount = 0;
+};
+
+}  // namespace ARcane
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+#include "ARcane/Camera/Camera.hpp"
+#include "ARcane/Renderer/Shader.hpp"
+#include "ARcane/Renderer/Texture.hpp"
+
+#include <glad/glad.h>
+#include <chrono>
+
+namespace ARcane {
+
+/**
+ * @class AutoExposure
+ * @brief Meters camera frames on the GPU and adapts the exposure towards a target luminance.
+ *
+ * Measure() dispatches a compute shader that builds a 64-bin histogram of log luminance over the
+ * frame texture into one of a ring of storage buffers, followed by a fence. Update() collects the
+ * histograms whose fence has signaled without waiting, averages the log luminance between the
+ * configured percentiles and moves the exposure towards TargetLuminance / average, exponentially
+ * in stops. Only the 256-byte histogram comes back to the CPU; no CPU pass touches the pixels.
+ * If every buffer is still in flight the frame is simply not metered.
+ *
+ * Frames are metered before any image adjustment, so the result does not feed back into itself.
+ * Renderer2D::DrawCameraStream drives this for cameras with auto exposure enabled.
+ */
+class AutoExposure {
+   public:
+    // How luminance is read from the texture, must match LuminanceHistogram.glsl
+    enum class Source : int { RGB = 0, Y = 1, YUYV = 2 };
+
+    /**
+     * @param histogramShader The LuminanceHistogram.glsl compute program, shared between meters.
+     * @param latency Number of histograms kept in flight (frames of latency before a result).
+     */
+    AutoExposure(const Ref<Shader>& histogramShader, uint32_t latency = 3);
+    ~AutoExposure();
+
+    AutoExposure(const AutoExposure&) = delete;
+    AutoExposure& operator=(const AutoExposure&) = delete;
+
+    /**
+     * @brief Queues the histogram of a frame.
+     * @return False if it was skipped because every buffer was in flight.
+     */
+    bool Measure(const Texture2D& texture, Source source);
+
+    /**
+     * @brief Collects finished histograms and adapts an exposure. Never waits.
+     * @return The new exposure, unchanged until a first histogram is available.
+     */
+    float Update(float exposure, const AutoExposureSettings& settings);
+
+    // Average linear luminance of the last collected histogram, before exposure
+    inline float GetMeasuredLuminance() const { return m_MeasuredLuminance; }
+    inline uint64_t GetSkippedCount() const { return m_SkippedCount; }
+
+   private:
+    struct Slot {
+        uint32_t Buffer = 0;     // Shader storage buffer holding the bins
+        GLsync Fence = nullptr;  // Non-null while the histogram is being built
+    };
+
+    float ComputeLuminance(const uint32_t* bins, const AutoExposureSettings& settings) const;
+
+    Ref<Shader> m_Shader;
+    std::vector<Slot> m_Slots;
+    uint32_t m_Head = 0;  // Next slot to measure into
+    uint32_t m_Tail = 0;  // Oldest slot in flight
+
+    float m_MeasuredLuminance = 0.0f;  // 0 = nothing measured yet
+    std::chrono::steady_clock::time_point m_LastUpdate;
+    uint64_t m_SkippedCount = 0;
+};
+
+}  // namespace ARcane
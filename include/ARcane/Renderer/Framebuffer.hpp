@@ -0,0 +1,93 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+
+namespace ARcane {
+
+/**
+ * @struct FramebufferSpecification
+ * @brief Describes the attachments of a Framebuffer.
+ */
+struct FramebufferSpecification {
+    uint32_t Width = 0, Height = 0;
+    uint32_t Samples = 1;         // > 1 renders multisampled and needs Resolve() before reading
+    bool DepthAttachment = true;  // Adds a depth/stencil attachment
+};
+
+/**
+ * @class Framebuffer
+ * @brief Offscreen render target with an RGBA8 color attachment and optional depth attachment.
+ *
+ * With Samples > 1 rendering goes to multisampled storage, and Resolve() blits it into a
+ * single-sampled color texture that can be sampled or read back.
+ *
+ * Example usage:
+ * @code
+ * Ref<Framebuffer> fb = CreateRef<Framebuffer>(FramebufferSpecification{1280, 720, 4});
+ * fb->Bind();
+ * // ... draw ...
+ * fb->Unbind();
+ * fb->Resolve();
+ * @endcode
+ */
+class Framebuffer {
+   public:
+    /**
+     * @brief Creates the framebuffer and its attachments.
+     * @param spec Size, sample count and attachments.
+     */
+    Framebuffer(const FramebufferSpecification& spec);
+
+    /**
+     * @brief Destroys the framebuffer and its attachments.
+     */
+    ~Framebuffer();
+
+    /**
+     * @brief Binds the framebuffer for drawing and sets the viewport to its size.
+     */
+    void Bind() const;
+
+    /**
+     * @brief Restores the default (window) framebuffer.
+     */
+    void Unbind() const;
+
+    /**
+     * @brief Recreates the attachments with a new size. Zero sizes are ignored.
+     */
+    void Resize(uint32_t width, uint32_t height);
+
+    /**
+     * @brief Resolves multisampled color into the sampleable color texture (no-op if Samples == 1).
+     */
+    void Resolve() const;
+
+    /**
+     * @brief Gets the single-sampled color texture (valid after Resolve() when multisampled).
+     */
+    uint32_t GetColorAttachmentRendererID() const;
+
+    /**
+     * @brief Gets the framebuffer that holds the resolved color, for reading pixels back.
+     */
+    uint32_t GetReadRendererID() const;
+
+    inline uint32_t GetRendererID() const { return m_RendererID; }
+    inline const FramebufferSpecification& GetSpecification() const { return m_Specification; }
+
+   private:
+    void Invalidate();  // (Re)creates all GL objects from the specification
+    void Release();
+
+    FramebufferSpecification m_Specification;
+
+    uint32_t m_RendererID = 0;       // Framebuffer that is rendered to
+    uint32_t m_ColorAttachment = 0;  // Texture (multisampled if Samples > 1)
+    uint32_t m_DepthAttachment = 0;  // Renderbuffer
+
+    uint32_t m_ResolveRendererID = 0;       // Only used when multisampled
+    uint32_t m_ResolveColorAttachment = 0;  // Only used when multisampled
+};
+
+}  // namespace ARcane
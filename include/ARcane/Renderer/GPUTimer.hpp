@@ -0,0 +1,64 @@
+#pragma once
+
+#include "ARcane/Core/Core.hpp"
+
+namespace ARcane {
+
+/**
+ * @class GPUTimer
+ * @brief Measures the GPU execution time of a render pass without stalling the pipeline.
+ *
+ * Each Begin()/End() pair records a GL_TIME_ELAPSED query into a small ring. Results are only
+ * read once the driver reports them as available, which is typically a few frames later, so the
+ * CPU never waits on the GPU. If every query in the ring is still in flight the pass is simply
+ * not measured.
+ *
+ * GL_TIME_ELAPSED queries cannot be nested, so only one timer may be active at a time. A Begin()
+ * while any timer is active is ignored and counted as skipped, along with its End().
+ */
+class GPUTimer {
+   public:
+    /**
+     * @brief Creates the query ring.
+     * @param latency Number of queries kept in flight (frames of latency before a result).
+     */
+    GPUTimer(uint32_t latency = 4);
+    ~GPUTimer();
+
+    /**
+     * @brief Starts timing a pass.
+     */
+    void Begin();
+
+    /**
+     * @brief Stops timing the current pass.
+     */
+    void End();
+
+    /**
+     * @brief Gets the GPU time of the most recently resolved pass.
+     * @return Elapsed GPU time in milliseconds.
+     */
+    inline float GetElapsedMs() const { return m_ElapsedMs; }
+
+    /**
+     * @brief Gets the number of passes skipped because the query ring was full or another pass
+     * was being timed.
+     */
+    inline uint32_t GetSkippedCount() const { return m_SkippedCount; }
+
+   private:
+    void Resolve();  // Collects every result that is already available, oldest first
+
+    std::vector<uint32_t> m_Queries;  // Ring of GL query objects
+    std::vector<bool> m_Pending;      // Whether each query is waiting for its result
+    uint32_t m_Head = 0;              // Next query to issue
+    uint32_t m_Tail = 0;              // Oldest query still in flight
+    bool m_Active = false;            // Whether a query is currently open
+    uint32_t m_NestedCount = 0;       // Begin() calls ignored while this timer's query is open
+
+    float m_ElapsedMs = 0.0f;
+    uint32_t m_SkippedCount = 0;
+};
+
+}  // namespace ARcane
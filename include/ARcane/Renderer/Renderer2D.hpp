@@ -6,6 +6,8 @@
 
 namespace ARcane {
 
+class CameraStream;
+
 class Renderer2D {
    public:
     static void Init();
@@ -17,6 +19,17 @@ class Renderer2D {
 
     static void DrawCVMat(const cv::Mat& frame, const glm::vec3& position, const glm::vec2& size);
 
+    // Draws the latest frame of a stream. Each stream keeps its own textures, which are only
+    // re-uploaded when a new frame was decoded, and the stream's upload and present latencies
+    // are recorded. Frames are uploaded in their decoded layout (BGR, RGBA, NV12, YUYV or I420)
+    // and converted by the camera shader, so the quad is drawn outside the batch. A stream may be
+    // destroyed on any thread, but not while it is being drawn.
+    static void DrawCameraStream(CameraStream& stream, const glm::vec3& position,
+                                 const glm::vec2& size);
+    // Called by the Application right after the buffer swap. Also frees the textures of
+    // streams destroyed since the last frame.
+    static void OnFramePresented();
+
     static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
     static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
     static void DrawQuad(const glm::vec2& position, const glm::vec2& size,
@@ -37,9 +50,30 @@ class Renderer2D {
                                 const Ref<Texture2D>& texture, float tilingFactor = 1.0f,
                                 const glm::vec4& tintColor = glm::vec4(1.0f));
 
+    // When enabled, quads that fall entirely outside the camera's clip volume are rejected before
+    // any vertices are written to the batch (disabled by default).
+    static void SetCullingEnabled(bool enabled);
+    static bool IsCullingEnabled();
+
+    // Why a batch was submitted to the GPU
+    enum class FlushReason { BufferFull, TextureSlotsFull, EndOfScene, CameraQuad };
+
     struct Statistics {
         uint32_t DrawCalls = 0;
         uint32_t QuadCount = 0;
+        uint32_t CulledQuadCount = 0;
+        uint32_t TextureBinds = 0;
+
+        uint64_t VertexBytesUploaded = 0;
+        uint64_t TextureBytesUploaded = 0;
+
+        uint32_t FlushesBufferFull = 0;
+        uint32_t FlushesTextureSlotsFull = 0;
+        uint32_t FlushesEndOfScene = 0;
+        uint32_t FlushesCameraQuad = 0;  // Batch split to keep the order around a camera frame
+
+        // GPU time of the scene pass. Resolved a few frames after submission, not reset.
+        float GPUTimeMs = 0.0f;
 
         uint32_t GetTotalVertexCount() const { return QuadCount * 4; }
         uint32_t GetTotalIndexCount() const { return QuadCount * 6; }
@@ -49,7 +83,8 @@ class Renderer2D {
     static Statistics GetStats();
 
    private:
-    static void FlushAndReset();
+    static void UploadAndFlush(FlushReason reason);
+    static void FlushAndReset(FlushReason reason);
 };
 
 }  // namespace ARcane
\ No newline at end of file
@@ -14,15 +14,25 @@ class Texture {
     virtual void Bind(uint32_t slot = 0) const = 0;
 };
 
+// Layout of the data passed to SetData()
+enum class TextureFormat {
+    RGBA8,  // 4 channels
+    BGR8,   // 3 channels in OpenCV order, swizzled to RGB by the driver during upload
+    RG8,    // 2 channels, e.g. the interleaved UV plane of NV12
+    R8,     // 1 channel, e.g. a luma plane
+    RG32F,  // 2 floats, e.g. a lookup table; sampled with linear filtering, clamped to the edge
+};
+
 class Texture2D : public Texture {
    public:
     Texture2D(const std::string& path);
-    Texture2D(uint32_t width, uint32_t height);
+    Texture2D(uint32_t width, uint32_t height, TextureFormat format = TextureFormat::RGBA8);
     ~Texture2D();
 
     inline uint32_t GetWidth() const override { return m_Width; }
     inline uint32_t GetHeight() const override { return m_Height; }
     inline uint32_t GetRendererID() const { return m_RendererID; }
+    inline TextureFormat GetFormat() const { return m_Format; }
 
     void SetData(void* data, uint32_t) override;
 
@@ -37,6 +47,8 @@ class Texture2D : public Texture {
     uint32_t m_Width, m_Height;
     uint32_t m_RendererID;
     GLenum m_InternalFormat, m_DataFormat;
+    GLenum m_DataType = GL_UNSIGNED_BYTE;
+    TextureFormat m_Format = TextureFormat::RGBA8;
 };
 
 }  // namespace ARcane
@@ -2,10 +2,59 @@
 
 namespace ARcane {
 
+bool CameraIntrinsics::HasDistortion() const {
+    for (float coefficient : Distortion) {
+        if (coefficient != 0.0f) return true;
+    }
+    return false;
+}
+
+glm::vec2 CameraIntrinsics::Distort(const glm::vec2& pixel) const {
+    const float k1 = Distortion[0], k2 = Distortion[1], p1 = Distortion[2], p2 = Distortion[3],
+                k3 = Distortion[4];
+
+    // Normalized image coordinates, then the radial and tangential terms of the OpenCV model
+    const glm::vec2 p = (pixel - PrincipalPoint) / FocalLength;
+    const float r2 = glm::dot(p, p);
+    const float radial = 1.0f + r2 * (k1 + r2 * (k2 + r2 * k3));
+    const glm::vec2 distorted = {
+        p.x * radial + 2.0f * p1 * p.x * p.y + p2 * (r2 + 2.0f * p.x * p.x),
+        p.y * radial + p1 * (r2 + 2.0f * p.y * p.y) + 2.0f * p2 * p.x * p.y,
+    };
+    return distorted * FocalLength + PrincipalPoint;
+}
+
 Camera::Camera(const glm::mat4& projection) : m_ProjectionMatrix(projection) {}
 
 Camera::Camera(const float degFov, const float width, const float height, const float nearP,
                const float farP)
     : m_ProjectionMatrix(glm::perspectiveFov(glm::radians(degFov), width, height, farP, nearP)) {}
 
+bool Camera::HasImageAdjustments() const {
+    const ImageAdjustments& a = m_ImageAdjustments;
+    return m_Exposure != 1.0f || a.WhiteBalance != glm::vec3(1.0f) || a.Contrast != 1.0f ||
+           a.Gamma != 1.0f || a.Sharpen > 0.0f || a.FalseColor;
+}
+
+void Camera::SetIntrinsics(const CameraIntrinsics& intrinsics) {
+    m_Intrinsics = intrinsics;
+    m_IntrinsicsVersion++;
+}
+
+void Camera::SetProjectionFromIntrinsics(const float nearP, const float farP) {
+    const CameraIntrinsics& k = m_Intrinsics;
+    if (!k.IsValid()) return;
+
+    // Frustum bounds on the plane at distance farP, which glm takes as the near plane since the
+    // planes are swapped like in SetPerspectiveProjectionMatrix(). Image y points down, and the
+    // image edges are at -0.5 and ImageSize - 0.5 since OpenCV puts pixel centers on integers.
+    const glm::vec2 first = glm::vec2(-0.5f) - k.PrincipalPoint;
+    const glm::vec2 last = k.ImageSize - 0.5f - k.PrincipalPoint;
+    const float left = first.x / k.FocalLength.x * farP;
+    const float right = last.x / k.FocalLength.x * farP;
+    const float top = -first.y / k.FocalLength.y * farP;
+    const float bottom = -last.y / k.FocalLength.y * farP;
+    m_ProjectionMatrix = glm::frustum(left, right, bottom, top, farP, nearP);
+}
+
 }  // namespace ARcane
\ No newline at end of file
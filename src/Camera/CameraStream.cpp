@@ -1,24 +1,57 @@
 #include "ARcane/Camera/CameraStream.hpp"
+#include "ARcane/Camera/CameraStreamManager.hpp"
+#include "ARcane/Camera/SharedFrameRing.hpp"
 #include <opencv2/imgcodecs.hpp>
 
+#include <cstring>
+
 namespace ARcane {
 
 CameraStream::CameraStream(const glm::mat4& projection)
-    : Camera(projection), m_Running(false), m_Context(1), m_Subscriber(m_Context, ZMQ_SUB) {}
+    : Camera(projection), m_Decoder(FrameDecoder::Create()), m_Running(false) {}
 
 CameraStream::~CameraStream() {
-    // Signal the subscriber thread to stop and join it
+    // Signal the subscriber thread to stop and join it. The receive timeout bounds the wait.
     m_Running = false;
     if (m_SubscriberThread.joinable()) {
         m_SubscriberThread.join();
     }
+    if (m_Manager) {
+        m_Manager->RemoveStream(*this);
+    }
     m_Subscriber.close();
-    m_Context.close();
+    if (m_Context) {
+        m_Context->close();
+    }
+}
+
+zmq::context_t& CameraStream::GetContext() {
+    if (m_Manager) {
+        return m_Manager->GetContext();
+    }
+    if (!m_Context) {
+        m_Context = CreateScope<zmq::context_t>(1);
+    }
+    return *m_Context;
 }
 
 void CameraStream::StartSubscriberThread(const std::string& url) {
+    ARC_CORE_ASSERT(!m_Manager, "Managed streams are received by their CameraStreamManager!");
+
+    // Same-host shared memory ring instead of a ZMQ socket
+    static const std::string sharedMemoryScheme = "shm://";
+    if (url.compare(0, sharedMemoryScheme.size(), sharedMemoryScheme) == 0) {
+        m_Running = true;
+        m_SubscriberThread = std::thread(&CameraStream::SharedMemoryLoop, this,
+                                         url.substr(sharedMemoryScheme.size()));
+        return;
+    }
+
     // Connect to the publisher URL and subscribe to all messages
     try {
+        m_Subscriber = zmq::socket_t(GetContext(), ZMQ_SUB);
+        m_Subscriber.set(zmq::sockopt::linger, 0);
+        m_Subscriber.set(zmq::sockopt::rcvtimeo, ReceiveTimeoutMs);
         m_Subscriber.connect(url);
         m_Subscriber.set(zmq::sockopt::subscribe, "");
 
@@ -32,31 +65,565 @@ void CameraStream::StartSubscriberThread(const std::string& url) {
 
 void CameraStream::SubscriberLoop() {
     while (m_Running) {
-        zmq::message_t message;
+        zmq::message_t payload;
+        FrameInfo info;
         try {
-            // Blocking call to receive the next frame
-            if (m_Subscriber.recv(message, zmq::recv_flags::none)) {
-                // Convert the received data into a std::vector
-                std::vector<uchar> buffer(static_cast<uchar*>(message.data()),
-                                          static_cast<uchar*>(message.data()) + message.size());
-                // Decode the JPEG buffer into an OpenCV Mat
-                cv::Mat frame = cv::imdecode(buffer, cv::IMREAD_COLOR);
-                if (!frame.empty()) {
-                    // Lock and update the frame atomically
-                    std::lock_guard<std::mutex> lock(m_FrameMutex);
-                    m_Frame = frame;
-                }
+            // Blocks for at most ReceiveTimeoutMs so that m_Running is checked regularly
+            if (ReceiveMessage(m_Subscriber, payload, info, zmq::recv_flags::none)) {
+                PushFrame(payload.data(), payload.size(), info);
             }
         } catch (const zmq::error_t& e) {
             ARC_CORE_ERROR("ZMQ Error: {}", (const char*)e.what());
+            m_Stats.RecordTransportError();
+        }
+    }
+}
+
+bool CameraStream::ReceiveMessage(zmq::socket_t& socket, zmq::message_t& payload,
+                                  FrameInfo& info, zmq::recv_flags flags) {
+    zmq::message_t message;
+    if (!socket.recv(message, flags)) {
+        return false;
+    }
+    info.ReceiveNs = GetSteadyClockNs();
+    info.ReceiveWallNs = GetWallClockNs();
+
+    // Multipart messages start with a FrameHeader, the payload is the next part. Only the
+    // header is copied; the payload is decoded straight from the message. The remaining parts
+    // of a multipart message are always available once the first one arrived.
+    if (message.more()) {
+        info.HasHeader = FrameHeader::Parse(message.data(), message.size(), info.Header);
+        if (!socket.recv(payload, zmq::recv_flags::none)) {
+            return false;
+        }
+
+        // Skip trailing parts this version does not know about
+        bool more = payload.more();
+        while (more) {
+            zmq::message_t extra;
+            if (!socket.recv(extra, zmq::recv_flags::none)) break;
+            more = extra.more();
         }
+    } else {
+        payload = std::move(message);
+    }
+
+    OnFrameReceived(payload.data(), payload.size(), info);
+    return true;
+}
+
+void CameraStream::SharedMemoryLoop(const std::string& name) {
+    using namespace std::chrono;
+
+    Scope<SharedFrameReader> reader;
+    std::vector<uint8_t> copy;  // Only used while recording
+    FrameHeader lastHeader;     // Of the last frame taken, kept across reopens
+    bool reopened = false;
+
+    // Frames the reader jumped over or threw away never reach OnFrameReceived(), so the sequence
+    // moves past them here; otherwise they would be counted as lost as well
+    auto skip = [this](uint64_t count) {
+        m_Stats.RecordDropped(FrameDropReason::Skipped, count);
+        m_LastSequence += count;
+    };
+
+    while (m_Running) {
+        if (!reader) {
+            // The writer may not be up yet
+            reader = CreateScope<SharedFrameReader>(name);
+            if (!reader->IsOpen()) {
+                reader.reset();
+                std::this_thread::sleep_for(milliseconds(ReceiveTimeoutMs));
+                continue;
+            }
+        }
+
+        // Futex wait, bounded so that m_Running is checked regularly
+        if (!reader->Wait(milliseconds(ReceiveTimeoutMs))) {
+            // A writer that was restarted (or crashed and restarted) creates a new ring. A writer
+            // that is merely idle keeps its ring, which must not be reopened: that would take
+            // its last frame a second time.
+            if (reader->IsStale()) {
+                reader.reset();
+                reopened = lastHeader.Magic == FrameHeaderMagic;
+            }
+            continue;
+        }
+
+        SharedFrameReader::Frame frame;
+        uint64_t skipped = 0;
+        if (!reader->Acquire(frame, skipped)) {
+            continue;
+        }
+        skip(skipped);
+
+        // A new reader starts at the newest frame, which can still be the one taken last if the
+        // writer was slow to replace its ring
+        if (reopened) {
+            reopened = false;
+            if (frame.Header.Magic == FrameHeaderMagic &&
+                frame.Header.CameraId == lastHeader.CameraId &&
+                frame.Header.Sequence == lastHeader.Sequence &&
+                frame.Header.CaptureTimestampNs == lastHeader.CaptureTimestampNs) {
+                continue;
+            }
+        }
+        lastHeader = frame.Header;
+
+        FrameInfo info;
+        info.ReceiveNs = GetSteadyClockNs();
+        info.ReceiveWallNs = GetWallClockNs();
+        info.HasHeader = frame.Header.Magic == FrameHeaderMagic;
+        info.Header = frame.Header;
+
+        // The frame is decoded straight from the ring and only counted and published if the
+        // writer did not overwrite it meanwhile. That is safe because the decoders write no more
+        // than the size the back frame was allocated for, even when the data changes under them.
+        // The recorder cannot take a frame back, so while recording it is copied out first.
+        const uint8_t* data = frame.Data;
+        bool recording = std::atomic_load(&m_Recorder) != nullptr;
+        if (recording) {
+            copy.assign(frame.Data, frame.Data + frame.Size);
+            data = copy.data();
+            if (!reader->IsValid(frame)) {
+                skip(1);
+                continue;
+            }
+            OnFrameReceived(data, frame.Size, info);
+        }
+
+        bool decoded = DecodeFrame(data, frame.Size, info);
+        if (!recording) {
+            if (!reader->IsValid(frame)) {
+                skip(1);
+                if (IsInterFrameEncoding(info.Header.Encoding) && m_VideoDecoder) {
+                    // The decoder's reference pictures may now be corrupted
+                    m_VideoDecoder->Flush();
+                    m_WaitForKeyframe = true;
+                }
+                continue;
+            }
+            OnFrameReceived(data, frame.Size, info);
+        }
+        if (decoded) {
+            PublishFrame(info);
+        }
+    }
+}
+
+void CameraStream::OnFrameReceived(const void* payload, size_t size, FrameInfo& info) {
+    uint64_t sequence = 0;
+    bool sequenced = info.HasHeader;
+    if (sequenced) {
+        sequence = info.Header.Sequence;
+    } else {
+        JpegStamp stamp;
+        sequenced = JpegStamp::Parse(payload, size, stamp);
+        sequence = stamp.Sequence;
+    }
+    if (sequenced) {
+        if (m_Stats.GetReceivedCount() > 0 && sequence > m_LastSequence + 1) {
+            m_Stats.RecordDropped(FrameDropReason::Lost, sequence - m_LastSequence - 1);
+        }
+        m_LastSequence = sequence;
+    }
+    m_Stats.RecordReceived(size, info.ReceiveNs);
+
+    // The only stage that crosses processes, so the only one measured on the wall clock
+    if (info.HasHeader && info.Header.CaptureTimestampNs &&
+        info.ReceiveWallNs >= info.Header.CaptureTimestampNs) {
+        m_Latency.Receive.Record((info.ReceiveWallNs - info.Header.CaptureTimestampNs) / 1000);
+    }
+
+    // Record the compressed payload before decoding, no re-encoding needed. Every JPEG decodes
+    // on its own, so each one is a keyframe; video frames carry the flag in their header.
+    if (auto recorder = std::atomic_load(&m_Recorder)) {
+        recorder->Append(payload, (uint32_t)size, info.ReceiveWallNs,
+                         info.IsKeyframe() ? SessionRecordKeyframe : 0);
+    }
+}
+
+bool CameraStream::PushFrame(const void* data, size_t size, FrameInfo info) {
+    if (!DecodeFrame(data, size, info)) {
+        return false;
+    }
+    PublishFrame(info);
+    return true;
+}
+
+bool CameraStream::DecodeFrame(const void* data, size_t size, FrameInfo& info) {
+    ARC_PROFILE_FUNCTION();
+    info.DecodeStartNs = GetSteadyClockNs();
+    if (!info.ReceiveNs) {
+        info.ReceiveNs = info.DecodeStartNs;
+    }
+
+    // Frame rate limit, with 10% slack so that e.g. 15 fps out of a jittery 30 fps source keeps
+    // every other frame instead of aliasing down to 10 fps
+    float maxFrameRate = m_MaxFrameRate;
+    bool rateLimited = maxFrameRate > 0.0f && m_LastDecodeNs &&
+                       info.ReceiveNs - m_LastDecodeNs < (uint64_t)(0.9e9 / maxFrameRate);
+    bool video = info.HasHeader && IsInterFrameEncoding(info.Header.Encoding);
+    if (rateLimited && !video) {
+        m_Stats.RecordDropped(FrameDropReason::RateLimited);
+        return false;
+    }
+
+    if (video) {
+        // Every access unit has to go through the decoder to keep its reference pictures, the
+        // rate limit only drops the output
+        if (!DecodeVideoFrame(data, size, info)) {
+            return false;
+        }
+        if (rateLimited) {
+            m_Stats.RecordDropped(FrameDropReason::RateLimited);
+            return false;
+        }
+        m_SourceWidth = m_BackFrame.GetMat().cols;
+        m_SourceHeight = m_BackFrame.GetMat().rows * 2 / 3;
+    } else if (info.HasHeader && info.Header.Encoding != FrameEncoding::JPEG) {
+        // Uncompressed: kept as is, color conversion happens in the camera shader
+        if (!CopyRawFrame(data, size, info)) {
+            m_Stats.RecordDropped(FrameDropReason::DecodeFailed);
+            return false;
+        }
+        m_SourceWidth = (int)info.Header.Width;
+        m_SourceHeight = (int)info.Header.Height;
+    } else {
+        // Decode straight from the caller's buffer into the back frame, whose memory is reused
+        // once the sizes settle. Reduced decoding lets libjpeg skip most of the IDCT work for
+        // small tiles.
+        DecodeOptions options;
+        options.Scale = m_DecodeScale;
+        options.Format = m_OutputFormat;
+        options.BottomUp = m_OutputBottomUp;
+        int width, height;
+        if (!m_Decoder->GetOutputSize(data, size, options.Scale, width, height)) {
+            m_Stats.RecordDropped(FrameDropReason::DecodeFailed);
+            return false;
+        }
+        cv::Mat& output = PrepareBackFrame(
+            height, width, options.Format == FramePixelFormat::RGBA ? CV_8UC4 : CV_8UC3);
+        if (!m_Decoder->Decode(data, size, options, output.data, width, height, output.step)) {
+            m_Stats.RecordDropped(FrameDropReason::DecodeFailed);
+            return false;
+        }
+        info.Format = options.Format;
+        info.BottomUp = options.BottomUp;
+
+        if (info.HasHeader && info.Header.Width && info.Header.Height) {
+            m_SourceWidth = (int)info.Header.Width;
+            m_SourceHeight = (int)info.Header.Height;
+        } else {
+            m_SourceWidth = width * (int)options.Scale;
+            m_SourceHeight = height * (int)options.Scale;
+        }
+    }
+    m_SourceEncoding = info.HasHeader ? info.Header.Encoding : FrameEncoding::JPEG;
+    info.DecodedNs = GetSteadyClockNs();
+    return true;
+}
+
+void CameraStream::PublishFrame(FrameInfo& info) {
+    m_LastDecodeNs = info.ReceiveNs;
+    m_Latency.Decode.Record((info.DecodedNs - info.ReceiveNs) / 1000);
+    m_Stats.RecordDecoded(info.DecodedNs - info.DecodeStartNs, info.DecodedNs);
+
+    // The old front frame goes back to the pool, unless the renderer still holds it
+    std::lock_guard<std::mutex> lock(m_FrameMutex);
+    info.Index = m_FrameInfo.Index + 1;
+    m_Frame = std::move(m_BackFrame);
+    m_FrameInfo = info;
+    m_FrameConsumed = false;
+    if (m_Pacer.IsEnabled()) {
+        m_Pacer.Push(m_Frame, info);
+    }
+}
+
+bool CameraStream::CopyRawFrame(const void* data, size_t size, FrameInfo& info) {
+    const int width = (int)info.Header.Width;
+    const int height = (int)info.Header.Height;
+
+    int rows = height, type;
+    size_t expected = (size_t)width * height;
+    bool evenWidth = false, evenHeight = false;  // Chroma subsampling
+    switch (info.Header.Encoding) {
+        case FrameEncoding::NV12:
+            // Both planes in one single channel matrix, UV rows below the Y rows
+            rows = height + height / 2;
+            type = CV_8UC1;
+            expected = (size_t)width * rows;
+            evenWidth = evenHeight = true;
+            info.Format = FramePixelFormat::NV12;
+            break;
+        case FrameEncoding::YUYV:
+            type = CV_8UC2;
+            expected *= 2;
+            evenWidth = true;
+            info.Format = FramePixelFormat::YUYV;
+            break;
+        case FrameEncoding::BGR:
+            type = CV_8UC3;
+            expected *= 3;
+            info.Format = FramePixelFormat::BGR;
+            break;
+        case FrameEncoding::RGBA:
+            type = CV_8UC4;
+            expected *= 4;
+            info.Format = FramePixelFormat::RGBA;
+            break;
+        default:
+            ARC_CORE_ERROR("Unknown frame encoding {0}", (int)info.Header.Encoding);
+            return false;
+    }
+    info.BottomUp = false;
+
+    // Chroma is uploaded at exactly half the size, as for video frames, which VideoDecoder
+    // only accepts with an even size too
+    if ((evenWidth && (width & 1)) || (evenHeight && (height & 1))) {
+        ARC_CORE_ERROR("Chroma subsampled raw frame of {0}x{1} needs an even size", width, height);
+        return false;
+    }
+
+    if (width <= 0 || height <= 0 || size != expected) {
+        ARC_CORE_ERROR("Raw frame of {0}x{1} has {2} bytes, expected {3}", width, height, size,
+                       expected);
+        return false;
+    }
+
+    memcpy(PrepareBackFrame(rows, width, type).data, data, size);
+    return true;
+}
+
+bool CameraStream::DecodeVideoFrame(const void* data, size_t size, FrameInfo& info) {
+    const FrameEncoding encoding = info.Header.Encoding;
+    if (encoding != m_VideoEncoding) {
+        // First video frame, or the publisher switched codecs. A failed Create() is not retried
+        // for every frame.
+        m_VideoDecoder = VideoDecoder::Create(encoding, m_VideoDecoderSettings);
+        m_VideoEncoding = encoding;
+        m_WaitForKeyframe = true;
+    }
+    if (!m_VideoDecoder) {
+        m_Stats.RecordDropped(FrameDropReason::DecodeFailed);
+        return false;
+    }
+
+    // After joining mid-stream or losing frames, everything up to the next keyframe references
+    // pictures the decoder never saw and would only decode to garbage
+    const uint64_t sequence = info.Header.Sequence;
+    if (!m_WaitForKeyframe && sequence != m_LastVideoSequence + 1) {
+        m_VideoDecoder->Flush();
+        m_WaitForKeyframe = true;
+    }
+    m_LastVideoSequence = sequence;
+    if (m_WaitForKeyframe) {
+        if (!info.IsKeyframe()) {
+            m_Stats.RecordDropped(FrameDropReason::WaitingForKeyframe);
+            return false;
+        }
+        m_WaitForKeyframe = false;
+    }
+
+    // Sized like the previous frame; the decoder only reallocates when the resolution changes,
+    // and the first frame has to be decoded before its size is known
+    if (m_VideoFrameSize.empty()) {
+        m_BackFrame.Reset();
+    } else {
+        PrepareBackFrame(m_VideoFrameSize.height, m_VideoFrameSize.width, CV_8UC1);
+    }
+    // No output without an error is a decoder still filling its pipeline, not a drop
+    cv::Mat& output = m_BackFrame.GetMat();
+    const uint64_t errors = m_VideoDecoder->GetErrorCount();
+    if (!m_VideoDecoder->Decode(data, size, output)) {
+        if (m_VideoDecoder->GetErrorCount() != errors) {
+            m_Stats.RecordDropped(FrameDropReason::DecodeFailed);
+        }
+        return false;
+    }
+    m_VideoFrameSize = output.size();
+    info.Format = FramePixelFormat::I420;
+    info.BottomUp = false;
+    return true;
+}
+
+bool CameraStream::WaitForFrameConsumed(std::chrono::milliseconds timeout) const {
+    std::unique_lock<std::mutex> lock(m_FrameMutex);
+    return m_FrameConsumedCondition.wait_for(lock, timeout, [this] { return m_FrameConsumed; });
+}
+
+void CameraStream::SetDecodeSettings(const DecodeSettings& settings) {
+    ARC_CORE_ASSERT(settings.Scale == 1 || settings.Scale == 2 || settings.Scale == 4 ||
+                        settings.Scale == 8,
+                    "Decode scale must be 1, 2, 4 or 8!");
+    m_DecodeScale = settings.Scale;
+    m_MaxFrameRate = settings.MaxFrameRate;
+}
+
+DecodeSettings CameraStream::GetDecodeSettings() const {
+    DecodeSettings settings;
+    settings.Scale = m_DecodeScale;
+    settings.MaxFrameRate = m_MaxFrameRate;
+    return settings;
+}
+
+void CameraStream::SetDecoder(Scope<FrameDecoder> decoder) { m_Decoder = std::move(decoder); }
+
+void CameraStream::SetVideoDecoderSettings(const VideoDecoderSettings& settings) {
+    m_VideoDecoderSettings = settings;
+}
+
+void CameraStream::SetOutputFormat(FramePixelFormat format, bool bottomUp) {
+    m_OutputFormat = format;
+    m_OutputBottomUp = bottomUp;
+}
+
+glm::ivec2 CameraStream::GetSourceSize() const { return {m_SourceWidth, m_SourceHeight}; }
+
+void CameraStream::SetRecorder(const Ref<SessionRecorder>& recorder) {
+    std::atomic_store(&m_Recorder, recorder);
+}
+
+bool CameraStream::StartCapture(const std::string& path) {
+    auto recorder = CreateRef<SessionRecorder>(path);
+    if (!recorder->IsOpen()) {
+        return false;
+    }
+
+    SetRecorder(recorder);
+    return true;
+}
+
+void CameraStream::StopCapture() {
+    // Detach first so the subscriber thread stops appending, then flush on this thread
+    auto recorder = std::atomic_exchange(&m_Recorder, Ref<SessionRecorder>());
+    if (recorder) {
+        recorder->Stop();
     }
 }
 
 cv::Mat CameraStream::GetFrame() const {
+    FrameInfo info;
+    return GetFrame(info);
+}
+
+cv::Mat CameraStream::GetFrame(FrameInfo& info) const {
     // Return a clone of the current frame to ensure thread safety
+    cv::Mat frame;
+    {
+        std::lock_guard<std::mutex> lock(m_FrameMutex);
+        frame = m_Frame.GetMat().clone();
+        info = m_FrameInfo;
+        m_FrameConsumed = true;
+    }
+    m_FrameConsumedCondition.notify_all();
+    return frame;
+}
+
+FrameBuffer CameraStream::AcquireFrame(FrameInfo& info) const {
+    FrameBuffer frame;
+    {
+        std::lock_guard<std::mutex> lock(m_FrameMutex);
+        frame = m_Frame;
+        info = m_FrameInfo;
+        m_FrameConsumed = true;
+    }
+    m_FrameConsumedCondition.notify_all();
+    return frame;
+}
+
+FrameBuffer CameraStream::AcquireFrame(FrameInfo& info, uint64_t displayNs) {
+    FrameBuffer frame;
+    {
+        std::lock_guard<std::mutex> lock(m_FrameMutex);
+        if (!m_Pacer.IsEnabled()) {
+            frame = m_Frame;
+            info = m_FrameInfo;
+        } else if (!m_Pacer.Select(displayNs, frame, info)) {
+            return frame;
+        }
+        m_FrameConsumed = info.Index == m_FrameInfo.Index;
+    }
+    m_FrameConsumedCondition.notify_all();
+    return frame;
+}
+
+void CameraStream::SetFramePacingSettings(const FramePacingSettings& settings) {
+    std::lock_guard<std::mutex> lock(m_FrameMutex);
+    m_Pacer.SetSettings(settings);
+    m_PacedFrameCount = settings.Enabled ? settings.MaxFrames : 0;
+}
+
+FramePacingSettings CameraStream::GetFramePacingSettings() const {
+    std::lock_guard<std::mutex> lock(m_FrameMutex);
+    return m_Pacer.GetSettings();
+}
+
+FramePacer::Stats CameraStream::GetFramePacingStats() const {
     std::lock_guard<std::mutex> lock(m_FrameMutex);
-    return m_Frame.clone();
+    return m_Pacer.GetStats();
+}
+
+cv::Mat& CameraStream::PrepareBackFrame(int rows, int cols, int type) {
+    // A back frame left over from a failed decode goes back first
+    m_BackFrame.Reset();
+
+    // Frames outgrowing the pool get a new one, and so does a jitter buffer needing more
+    // buffers (the back frame, the one being shown and the queued ones). Handles into the old
+    // pool keep it alive.
+    const size_t size = (size_t)rows * cols * CV_ELEM_SIZE(type);
+    const uint32_t capacity = std::max(m_FramePoolSpecification.Capacity, m_PacedFrameCount + 2);
+    if (!m_FramePool || size > m_FramePool->GetBufferSize() ||
+        capacity > m_FramePool->GetCapacity()) {
+        FramePoolSpecification spec = m_FramePoolSpecification;
+        spec.Capacity = capacity;
+        spec.BufferSize = std::max(size, (size_t)1);
+        m_FramePool = CreateRef<FramePool>(spec);
+    }
+
+    m_BackFrame = m_FramePool->Acquire(rows, cols, type);
+    if (!m_BackFrame) {
+        // Every buffer is held somewhere, e.g. frames kept by the application
+        if (!m_FramePoolExhaustedWarned) {
+            ARC_CORE_WARN("Camera frame pool exhausted ({0} buffers), allocating frames",
+                          m_FramePool->GetCapacity());
+            m_FramePoolExhaustedWarned = true;
+        }
+        m_BackFrame = FrameBuffer::Allocate(rows, cols, type);
+    }
+    return m_BackFrame.GetMat();
+}
+
+void CameraStream::SetFramePoolSettings(uint32_t capacity, bool hugePages) {
+    ARC_CORE_ASSERT(capacity >= 2, "A stream needs at least a front and a back frame!");
+    m_FramePoolSpecification.Capacity = capacity;
+    m_FramePoolSpecification.HugePages = hugePages;
+}
+
+uint64_t CameraStream::GetFrameIndex() const {
+    std::lock_guard<std::mutex> lock(m_FrameMutex);
+    return m_FrameInfo.Index;
+}
+
+void CameraStream::RecordUploaded(const FrameInfo& info, uint64_t uploadedNs) {
+    if (info.DecodedNs && uploadedNs >= info.DecodedNs) {
+        m_Latency.Upload.Record((uploadedNs - info.DecodedNs) / 1000);
+    }
+}
+
+void CameraStream::RecordPresented(const FrameInfo& info, uint64_t presentedNs) {
+    // A frame stays on screen for several swaps, only the first one counts
+    if (info.Index == m_LastPresentedIndex) return;
+    m_LastPresentedIndex = info.Index;
+
+    // Receive to present on the steady clock, plus the capture to receive transit if known
+    if (!info.ReceiveNs || presentedNs < info.ReceiveNs) return;
+    uint64_t latencyNs = presentedNs - info.ReceiveNs;
+    if (info.HasHeader && info.Header.CaptureTimestampNs &&
+        info.ReceiveWallNs >= info.Header.CaptureTimestampNs) {
+        latencyNs += info.ReceiveWallNs - info.Header.CaptureTimestampNs;
+    }
+    m_Latency.Present.Record(latencyNs / 1000);
 }
 
 }  // namespace ARcane
@@ -0,0 +1,252 @@
+#include "ARcane/Camera/CameraStreamManager.hpp"
+
+#include <algorithm>
+
+namespace ARcane {
+
+CameraStreamManager::CameraStreamManager(uint32_t decodeThreads)
+    : m_Context(1), m_DecodeThreadCount(std::max(decodeThreads, 1u)), m_Running(false) {}
+
+CameraStreamManager::~CameraStreamManager() {
+    Stop();
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (auto& entry : m_Entries) {
+        entry->Socket.close();
+        entry->Stream->m_Manager = nullptr;
+    }
+    m_Entries.clear();
+    m_Context.close();
+}
+
+bool CameraStreamManager::AddStream(CameraStream& stream, const std::string& url, int priority) {
+    ARC_CORE_ASSERT(!stream.m_Manager, "Stream is already managed!");
+
+    auto entry = CreateScope<Entry>();
+    entry->Stream = &stream;
+    entry->Priority = priority;
+    try {
+        entry->Socket = zmq::socket_t(m_Context, ZMQ_SUB);
+        entry->Socket.set(zmq::sockopt::linger, 0);
+        entry->Socket.connect(url);
+        entry->Socket.set(zmq::sockopt::subscribe, "");
+    } catch (const zmq::error_t& e) {
+        ARC_CORE_ERROR("Failed to connect to {}: {}", url, (const char*)e.what());
+        return false;
+    }
+
+    // The socket moves to the I/O thread; the mutex provides the barrier ZMQ requires
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    stream.m_Manager = this;
+    m_Entries.push_back(std::move(entry));
+    m_EntriesChanged = true;
+    return true;
+}
+
+void CameraStreamManager::RemoveStream(CameraStream& stream) {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    Entry* entry = FindEntry(stream);
+    if (!entry) return;
+
+    entry->Removed = true;
+    entry->Pending.clear();
+    m_EntriesChanged = true;
+
+    if (m_ThreadsActive) {
+        // The socket belongs to the I/O thread: it closes it once no decode is in progress
+        // (or Stop() does after joining the threads)
+        m_EntryCondition.wait(lock, [&] { return !FindEntry(stream); });
+    } else {
+        entry->Socket.close();
+        m_Entries.erase(std::find_if(m_Entries.begin(), m_Entries.end(),
+                                     [&](const Scope<Entry>& e) { return e.get() == entry; }));
+    }
+    stream.m_Manager = nullptr;
+}
+
+void CameraStreamManager::SetPriority(const CameraStream& stream, int priority) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (Entry* entry = FindEntry(stream)) {
+        entry->Priority = priority;
+    }
+}
+
+size_t CameraStreamManager::GetStreamCount() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Entries.size();
+}
+
+void CameraStreamManager::Start() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_ThreadsActive) return;
+
+    m_Running = true;
+    m_ThreadsActive = true;
+    m_EntriesChanged = true;
+    m_IOThread = std::thread(&CameraStreamManager::IOLoop, this);
+    for (uint32_t i = 0; i < m_DecodeThreadCount; i++) {
+        m_DecodeThreads.emplace_back(&CameraStreamManager::DecodeLoop, this);
+    }
+}
+
+void CameraStreamManager::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_Running) return;
+        m_Running = false;
+    }
+    m_DecodeCondition.notify_all();
+
+    // The I/O thread wakes up within PollTimeoutMs, decoders after their current frame
+    m_IOThread.join();
+    for (auto& thread : m_DecodeThreads) {
+        thread.join();
+    }
+    m_DecodeThreads.clear();
+
+    // Streams removed while stopping are closed here
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_ThreadsActive = false;
+    for (auto it = m_Entries.begin(); it != m_Entries.end();) {
+        if ((*it)->Removed) {
+            (*it)->Socket.close();
+            it = m_Entries.erase(it);
+        } else {
+            (*it)->Pending.clear();
+            ++it;
+        }
+    }
+    m_EntryCondition.notify_all();
+}
+
+CameraStreamManager::Entry* CameraStreamManager::FindEntry(const CameraStream& stream) const {
+    for (auto& entry : m_Entries) {
+        if (entry->Stream == &stream) return entry.get();
+    }
+    return nullptr;
+}
+
+CameraStreamManager::Entry* CameraStreamManager::NextDecodeEntry() const {
+    Entry* next = nullptr;
+    for (auto& entry : m_Entries) {
+        if (entry->Pending.empty() || entry->Decoding) continue;
+
+        // Highest priority first, then whoever has been waiting the longest
+        if (!next || entry->Priority > next->Priority ||
+            (entry->Priority == next->Priority &&
+             entry->Pending.front().Info.ReceiveNs < next->Pending.front().Info.ReceiveNs)) {
+            next = entry.get();
+        }
+    }
+    return next;
+}
+
+void CameraStreamManager::IOLoop() {
+    std::vector<zmq_pollitem_t> items;
+    std::vector<Entry*> polled;
+
+    while (m_Running) {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_EntriesChanged) {
+                // Close removed sockets on this thread, the only one using them
+                bool removed = false;
+                for (auto it = m_Entries.begin(); it != m_Entries.end();) {
+                    if ((*it)->Removed && !(*it)->Decoding) {
+                        (*it)->Socket.close();
+                        it = m_Entries.erase(it);
+                        removed = true;
+                    } else {
+                        ++it;
+                    }
+                }
+                if (removed) m_EntryCondition.notify_all();
+
+                items.clear();
+                polled.clear();
+                for (auto& entry : m_Entries) {
+                    if (entry->Removed) continue;
+                    items.push_back({static_cast<void*>(entry->Socket), 0, ZMQ_POLLIN, 0});
+                    polled.push_back(entry.get());
+                }
+                m_EntriesChanged = std::any_of(m_Entries.begin(), m_Entries.end(),
+                                               [](const Scope<Entry>& e) { return e->Removed; });
+            }
+        }
+
+        if (items.empty()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(PollTimeoutMs));
+            continue;
+        }
+
+        if (zmq_poll(items.data(), (int)items.size(), PollTimeoutMs) <= 0) {
+            continue;  // Timeout (re-check m_Running) or interrupted
+        }
+
+        for (size_t i = 0; i < items.size(); i++) {
+            if (!(items[i].revents & ZMQ_POLLIN)) continue;
+            Entry* entry = polled[i];
+
+            // Drain everything that arrived; only the newest frame is kept for decoding, or for
+            // video everything since the last keyframe
+            try {
+                while (true) {
+                    zmq::message_t payload;
+                    FrameInfo info;
+                    if (!entry->Stream->ReceiveMessage(entry->Socket, payload, info,
+                                                       zmq::recv_flags::dontwait)) {
+                        break;
+                    }
+
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    if (entry->Removed) break;
+                    // A keyframe makes everything still waiting obsolete. Other video frames
+                    // need their predecessors; if too many pile up, the stream sees the gap and
+                    // waits for the next keyframe.
+                    if (info.IsKeyframe() || entry->Pending.size() >= MaxPendingVideoFrames) {
+                        entry->Stream->m_Stats.RecordDropped(FrameDropReason::Skipped,
+                                                             entry->Pending.size());
+                        entry->Pending.clear();
+                    }
+                    entry->Pending.push_back({std::move(payload), info});
+                }
+            } catch (const zmq::error_t& e) {
+                ARC_CORE_ERROR("ZMQ Error: {}", (const char*)e.what());
+                entry->Stream->m_Stats.RecordTransportError();
+            }
+            m_DecodeCondition.notify_one();
+        }
+    }
+}
+
+void CameraStreamManager::DecodeLoop() {
+    while (true) {
+        Entry* entry = nullptr;
+        zmq::message_t payload;
+        FrameInfo info;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_DecodeCondition.wait(lock, [&] {
+                return !m_Running || (entry = NextDecodeEntry()) != nullptr;
+            });
+            if (!m_Running) return;
+
+            payload = std::move(entry->Pending.front().Payload);
+            info = entry->Pending.front().Info;
+            entry->Pending.pop_front();
+            entry->Decoding = true;
+        }
+
+        entry->Stream->PushFrame(payload.data(), payload.size(), info);
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            entry->Decoding = false;
+        }
+        // Another frame of this stream may have arrived meanwhile; RemoveStream may be waiting
+        m_DecodeCondition.notify_one();
+        m_EntryCondition.notify_all();
+    }
+}
+
+}  // namespace ARcane
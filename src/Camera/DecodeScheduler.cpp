@@ -0,0 +1,122 @@
+#include "ARcane/Camera/DecodeScheduler.hpp"
+
+#include <algorithm>
+
+namespace ARcane {
+
+DecodeScheduler::DecodeScheduler(float budget)
+    : m_LastUpdate(std::chrono::steady_clock::now()), m_Budget(budget) {}
+
+void DecodeScheduler::AddStream(CameraStream& stream) {
+    Entry entry;
+    entry.Stream = &stream;
+    entry.LastReceivedCount = stream.GetReceivedCount();
+    m_Entries.push_back(entry);
+}
+
+void DecodeScheduler::RemoveStream(CameraStream& stream) {
+    auto it = std::find_if(m_Entries.begin(), m_Entries.end(),
+                           [&](const Entry& entry) { return entry.Stream == &stream; });
+    if (it != m_Entries.end()) {
+        stream.SetDecodeSettings(DecodeSettings());  // Back to full decoding
+        m_Entries.erase(it);
+    }
+}
+
+void DecodeScheduler::SetViewHint(const CameraStream& stream, const glm::vec2& size,
+                                  bool focused) {
+    for (auto& entry : m_Entries) {
+        if (entry.Stream == &stream) {
+            entry.Size = size;
+            entry.Focused = focused;
+            return;
+        }
+    }
+}
+
+// Scale and frame rate only make a JPEG stream cheaper to decode
+static bool IsDegradable(const CameraStream& stream) {
+    return stream.GetSourceEncoding() == FrameEncoding::JPEG;
+}
+
+float DecodeScheduler::GetCost(const Entry& entry) const {
+    glm::ivec2 source = entry.Stream->GetSourceSize();
+    float pixels = (float)source.x * (float)source.y / 1e6f;
+    float rate = entry.IncomingFrameRate;
+    if (!IsDegradable(*entry.Stream)) {
+        return pixels * rate;
+    }
+
+    float scale = (float)entry.Settings.Scale;
+    if (entry.Settings.MaxFrameRate > 0.0f) {
+        rate = std::min(rate, entry.Settings.MaxFrameRate);
+    }
+    return pixels / (scale * scale) * rate;
+}
+
+void DecodeScheduler::Update() {
+    auto now = std::chrono::steady_clock::now();
+    float elapsed = std::chrono::duration<float>(now - m_LastUpdate).count();
+    m_LastUpdate = now;
+
+    m_Load = 0.0f;
+    for (auto& entry : m_Entries) {
+        // Smooth the measured rate over about a second
+        uint64_t received = entry.Stream->GetReceivedCount();
+        if (elapsed > 0.0f) {
+            float rate = (received - entry.LastReceivedCount) / elapsed;
+            float alpha = std::min(elapsed, 1.0f);
+            entry.IncomingFrameRate += (rate - entry.IncomingFrameRate) * alpha;
+        }
+        entry.LastReceivedCount = received;
+
+        // Largest scale whose output still has at least as many pixels as the tile
+        glm::ivec2 source = entry.Stream->GetSourceSize();
+        DecodeSettings settings;
+        if (!entry.Focused && source.x > 0 && source.y > 0) {
+            while (IsDegradable(*entry.Stream) && settings.Scale < 8 &&
+                   source.x / (float)(settings.Scale * 2) >= entry.Size.x &&
+                   source.y / (float)(settings.Scale * 2) >= entry.Size.y) {
+                settings.Scale *= 2;
+            }
+            // Hidden tiles only need the occasional frame so they are current when shown
+            bool visible = entry.Size.x > 0.0f && entry.Size.y > 0.0f;
+            settings.MaxFrameRate = visible ? m_UnfocusedFrameRate : m_MinFrameRate;
+        }
+        entry.Settings = settings;
+        entry.Cost = GetCost(entry);
+        m_Load += entry.Cost;
+    }
+
+    // Over budget: degrade the most expensive unfocused stream one step at a time
+    while (m_Load > m_Budget) {
+        Entry* worst = nullptr;
+        for (auto& entry : m_Entries) {
+            bool degradable = IsDegradable(*entry.Stream) &&
+                              (entry.Settings.MaxFrameRate > m_MinFrameRate ||
+                               entry.Settings.Scale < 8);
+            if (!entry.Focused && degradable && entry.Cost > 0.0f &&
+                (!worst || entry.Cost > worst->Cost)) {
+                worst = &entry;
+            }
+        }
+        if (!worst) break;  // Only the focused stream is left
+
+        if (worst->Settings.MaxFrameRate > m_MinFrameRate) {
+            worst->Settings.MaxFrameRate =
+                std::max(worst->Settings.MaxFrameRate * 0.5f, m_MinFrameRate);
+        } else {
+            worst->Settings.Scale *= 2;
+        }
+
+        float cost = GetCost(*worst);
+        m_Load -= worst->Cost - cost;
+        worst->Cost = cost;
+    }
+
+    for (auto& entry : m_Entries) {
+        entry.Stream->SetDecodeSettings(entry.Settings);
+    }
+}
+
+}  // namespace ARcane
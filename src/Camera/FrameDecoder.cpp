@@ -0,0 +1,161 @@
+#include "ARcane/Camera/FrameDecoder.hpp"
+#include <opencv2/imgcodecs.hpp>
+
+#ifdef ARC_HAS_TURBOJPEG
+#include <turbojpeg.h>
+#endif
+
+namespace ARcane {
+
+Scope<FrameDecoder> FrameDecoder::Create() {
+#ifdef ARC_HAS_TURBOJPEG
+    return CreateScope<TurboJpegDecoder>();
+#else
+    return CreateScope<OpenCVDecoder>();
+#endif
+}
+
+bool FrameDecoder::Decode(const void* data, size_t size, const DecodeOptions& options,
+                          cv::Mat& output) {
+    int width, height;
+    if (!GetOutputSize(data, size, options.Scale, width, height)) {
+        return false;
+    }
+
+    // No-op when the matrix already has this size and type
+    output.create(height, width, options.Format == FramePixelFormat::RGBA ? CV_8UC4 : CV_8UC3);
+    return Decode(data, size, options, output.data, width, height, output.step);
+}
+
+bool FrameDecoder::CheckOutput(const DecodeOptions& options, int width, int height,
+                               size_t stride) {
+    size_t pixelSize = options.Format == FramePixelFormat::RGBA ? 4 : 3;
+    return width > 0 && height > 0 && stride >= (size_t)width * pixelSize;
+}
+
+bool FrameDecoder::ReadJpegSize(const void* data, size_t size, int& width, int& height) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    if (size < 4 || bytes[0] != 0xFF || bytes[1] != 0xD8) return false;
+
+    // Walk the segments after SOI until a start-of-frame marker
+    size_t offset = 2;
+    while (offset + 9 <= size) {
+        if (bytes[offset] != 0xFF) return false;
+        uint8_t marker = bytes[offset + 1];
+        if (marker == 0xFF) {  // Fill byte
+            offset++;
+            continue;
+        }
+
+        // SOF0-SOF15, except DHT (C4), JPG (C8) and DAC (CC)
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 &&
+            marker != 0xCC) {
+            height = (bytes[offset + 5] << 8) | bytes[offset + 6];
+            width = (bytes[offset + 7] << 8) | bytes[offset + 8];
+            return width > 0 && height > 0;
+        }
+
+        offset += 2 + ((bytes[offset + 2] << 8) | bytes[offset + 3]);
+    }
+    return false;
+}
+
+bool OpenCVDecoder::GetOutputSize(const void* data, size_t size, uint32_t scale, int& width,
+                                  int& height) {
+    if (!ReadJpegSize(data, size, width, height)) return false;
+
+    // IMREAD_REDUCED_* rounds up, like libjpeg's DCT scaling
+    width = (width + (int)scale - 1) / (int)scale;
+    height = (height + (int)scale - 1) / (int)scale;
+    return true;
+}
+
+bool OpenCVDecoder::Decode(const void* data, size_t size, const DecodeOptions& options,
+                           uint8_t* output, int width, int height, size_t stride) {
+    if (!CheckOutput(options, width, height, stride)) return false;
+
+    // The orientation is ignored so the size matches the SOF segment GetOutputSize() reads
+    int flags = cv::IMREAD_IGNORE_ORIENTATION;
+    switch (options.Scale) {
+        case 2: flags |= cv::IMREAD_REDUCED_COLOR_2; break;
+        case 4: flags |= cv::IMREAD_REDUCED_COLOR_4; break;
+        case 8: flags |= cv::IMREAD_REDUCED_COLOR_8; break;
+        default: flags |= cv::IMREAD_COLOR; break;
+    }
+
+    cv::Mat buffer(1, (int)size, CV_8UC1, const_cast<void*>(data));
+    cv::imdecode(buffer, flags, &m_Decoded);  // Reuses the matrix when the size is unchanged
+    if (m_Decoded.empty() || m_Decoded.cols != width || m_Decoded.rows != height) {
+        return false;
+    }
+
+    // Wrap the caller's buffer; cvtColor/copyTo write into it since size and type match
+    int type = options.Format == FramePixelFormat::RGBA ? CV_8UC4 : CV_8UC3;
+    cv::Mat destination(height, width, type, output, stride);
+    if (options.Format == FramePixelFormat::RGBA) {
+        cv::cvtColor(m_Decoded, destination, cv::COLOR_BGR2RGBA);
+    } else {
+        m_Decoded.copyTo(destination);
+    }
+
+    if (options.BottomUp) {
+        cv::flip(destination, destination, 0);
+    }
+    return true;
+}
+
+#ifdef ARC_HAS_TURBOJPEG
+
+TurboJpegDecoder::TurboJpegDecoder() {
+    m_Handle = tjInitDecompress();
+    if (!m_Handle) {
+        ARC_CORE_ERROR("libjpeg-turbo: {0}", tjGetErrorStr2(nullptr));
+    }
+}
+
+TurboJpegDecoder::~TurboJpegDecoder() {
+    if (m_Handle) {
+        tjDestroy(m_Handle);
+    }
+}
+
+bool TurboJpegDecoder::GetOutputSize(const void* data, size_t size, uint32_t scale, int& width,
+                                     int& height) {
+    if (!m_Handle) return false;
+
+    int subsampling, colorspace;
+    if (tjDecompressHeader3(m_Handle, static_cast<const unsigned char*>(data), size, &width,
+                            &height, &subsampling, &colorspace) != 0) {
+        return false;
+    }
+
+    const tjscalingfactor factor = {1, (int)scale};
+    width = TJSCALED(width, factor);
+    height = TJSCALED(height, factor);
+    return true;
+}
+
+bool TurboJpegDecoder::Decode(const void* data, size_t size, const DecodeOptions& options,
+                              uint8_t* output, int width, int height, size_t stride) {
+    int frameWidth, frameHeight;
+    if (!CheckOutput(options, width, height, stride) ||
+        !GetOutputSize(data, size, options.Scale, frameWidth, frameHeight) ||
+        frameWidth != width || frameHeight != height) {
+        return false;
+    }
+
+    // Asking for the scaled size selects the matching DCT scaling factor. libjpeg-turbo never
+    // writes more than width x height, even if the data changes under it.
+    int pixelFormat = options.Format == FramePixelFormat::RGBA ? TJPF_RGBA : TJPF_BGR;
+    int flags = TJFLAG_FASTDCT | (options.BottomUp ? TJFLAG_BOTTOMUP : 0);
+    if (tjDecompress2(m_Handle, static_cast<const unsigned char*>(data), size, output, width,
+                      (int)stride, height, pixelFormat, flags) != 0) {
+        ARC_CORE_ERROR("libjpeg-turbo: {0}", tjGetErrorStr2(m_Handle));
+        return false;
+    }
+    return true;
+}
+
+#endif
+
+}  // namespace ARcane
@@ -0,0 +1,150 @@
+#include "ARcane/Camera/FramePacer.hpp"
+#include "ARcane/Camera/CameraStream.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ARcane {
+
+// The lowest transit is taken over two windows of this length, so it follows clock drift
+static constexpr int64_t TransitWindowNs = 2'000'000'000;
+// A transit change this large is a restarted publisher or a clock step, not jitter
+static constexpr int64_t ResyncThresholdNs = 1'000'000'000;
+
+struct FramePacer::Entry {
+    FrameBuffer Frame;
+    FrameInfo Info;
+    int64_t OriginNs = 0;
+};
+
+FramePacer::FramePacer(const FramePacingSettings& settings) { SetSettings(settings); }
+
+FramePacer::~FramePacer() {}
+
+void FramePacer::SetSettings(const FramePacingSettings& settings) {
+    ARC_CORE_ASSERT(settings.MaxFrames > 0, "The jitter buffer needs room for a frame!");
+    ARC_CORE_ASSERT(settings.MinDelayMs <= settings.MaxDelayMs, "Invalid frame pacing delays!");
+
+    m_Settings = settings;
+    m_Frames.reserve(settings.MaxFrames);
+    while (m_Frames.size() > settings.MaxFrames) {
+        m_Frames.erase(m_Frames.begin());
+        m_DroppedCount++;
+    }
+    if (!settings.Enabled) {
+        Reset();
+    }
+    m_TargetDelayNs = std::clamp(m_TargetDelayNs, settings.MinDelayMs * 1e6,
+                                 settings.MaxDelayMs * 1e6);
+}
+
+void FramePacer::Push(const FrameBuffer& frame, const FrameInfo& info) {
+    const int64_t originNs = (int64_t)info.GetOriginNs();
+    const int64_t decodedNs = (int64_t)info.DecodedNs;
+    const int64_t transitNs = decodedNs - originNs;
+
+    if (m_HasTransit && (std::abs(transitNs - m_LastTransitNs) > ResyncThresholdNs ||
+                         originNs < m_LastOriginNs)) {
+        Reset();
+    }
+
+    if (!m_HasTransit) {
+        m_HasTransit = true;
+        m_WindowMinNs = m_PreviousWindowMinNs = transitNs;
+        m_WindowStartNs = decodedNs;
+    } else {
+        // Interarrival jitter as in RFC 3550: smoothed difference of consecutive transit times
+        double difference = std::abs((double)(transitNs - m_LastTransitNs));
+        m_JitterNs += (difference - m_JitterNs) / 16.0;
+
+        double interval = (double)(originNs - m_LastOriginNs);
+        m_FrameIntervalNs = m_FrameIntervalNs > 0.0
+                                ? m_FrameIntervalNs + (interval - m_FrameIntervalNs) / 16.0
+                                : interval;
+
+        if (decodedNs - m_WindowStartNs > TransitWindowNs) {
+            m_PreviousWindowMinNs = m_WindowMinNs;
+            m_WindowMinNs = transitNs;
+            m_WindowStartNs = decodedNs;
+        } else {
+            m_WindowMinNs = std::min(m_WindowMinNs, transitNs);
+        }
+    }
+    m_LastTransitNs = transitNs;
+    m_LastOriginNs = originNs;
+
+    // A frame arriving after its scheduled time means the target is too short: cover it at
+    // once. Otherwise drift towards the jitter estimate, slowly so the next clump still fits.
+    const double minDelayNs = m_Settings.MinDelayMs * 1e6;
+    const double maxDelayNs = m_Settings.MaxDelayMs * 1e6;
+    const double spreadNs = (double)(transitNs - GetBaseTransitNs());
+    if (spreadNs > m_TargetDelayNs) {
+        m_TargetDelayNs = std::min(spreadNs, maxDelayNs);
+    } else {
+        double desired = std::clamp(m_Settings.JitterMultiplier * m_JitterNs, minDelayNs,
+                                    maxDelayNs);
+        m_TargetDelayNs += (desired - m_TargetDelayNs) / 64.0;
+    }
+
+    if (m_Frames.size() >= m_Settings.MaxFrames) {
+        m_Frames.erase(m_Frames.begin());
+        m_DroppedCount++;
+    }
+    m_Frames.push_back({frame, info, originNs});
+}
+
+bool FramePacer::Select(uint64_t displayNs, FrameBuffer& frame, FrameInfo& info) {
+    if (m_Frames.empty()) return false;
+
+    const int64_t offsetNs = GetBaseTransitNs() + (int64_t)m_TargetDelayNs;
+    const int64_t maxDelayNs = (int64_t)(m_Settings.MaxDelayMs * 1e6);
+    // Half a frame of tolerance picks the frame scheduled closest to the display time
+    const int64_t toleranceNs = (int64_t)(m_FrameIntervalNs / 2.0);
+
+    // Newest frame that is due, or that has waited as long as the cap allows
+    int chosen = -1;
+    bool late = false;
+    for (size_t i = 0; i < m_Frames.size(); i++) {
+        const Entry& entry = m_Frames[i];
+        bool due = entry.OriginNs + offsetNs <= (int64_t)displayNs + toleranceNs;
+        bool overdue = (int64_t)displayNs - (int64_t)entry.Info.DecodedNs >= maxDelayNs;
+        if (due || overdue) {
+            chosen = (int)i;
+            late = !due;
+        }
+    }
+    if (chosen < 0) return false;
+
+    frame = std::move(m_Frames[chosen].Frame);
+    info = m_Frames[chosen].Info;
+    m_Frames.erase(m_Frames.begin(), m_Frames.begin() + chosen + 1);
+    m_DroppedCount += chosen;
+    if (late) {
+        m_LateCount++;
+    }
+    return true;
+}
+
+void FramePacer::Reset() {
+    m_Frames.clear();
+    m_HasTransit = false;
+    m_JitterNs = 0.0;
+    m_FrameIntervalNs = 0.0;
+    m_TargetDelayNs = m_Settings.MinDelayMs * 1e6;
+}
+
+FramePacer::Stats FramePacer::GetStats() const {
+    Stats stats;
+    stats.JitterMs = (float)(m_JitterNs / 1e6);
+    stats.TargetDelayMs = (float)(m_TargetDelayNs / 1e6);
+    stats.QueuedFrames = (uint32_t)m_Frames.size();
+    stats.DroppedCount = m_DroppedCount;
+    stats.LateCount = m_LateCount;
+    return stats;
+}
+
+int64_t FramePacer::GetBaseTransitNs() const {
+    return std::min(m_WindowMinNs, m_PreviousWindowMinNs);
+}
+
+}  // namespace ARcane
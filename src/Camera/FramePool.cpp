@@ -0,0 +1,141 @@
+#include "ARcane/Camera/FramePool.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace ARcane {
+
+static constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+FrameBuffer::FrameBuffer(const FrameBuffer& other)
+    : m_Mat(other.m_Mat), m_Slot(other.m_Slot), m_Pool(other.m_Pool) {
+    if (m_Slot) {
+        m_Slot->RefCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+FrameBuffer::FrameBuffer(FrameBuffer&& other) noexcept
+    : m_Mat(std::move(other.m_Mat)), m_Slot(other.m_Slot), m_Pool(std::move(other.m_Pool)) {
+    other.m_Slot = nullptr;
+}
+
+FrameBuffer& FrameBuffer::operator=(const FrameBuffer& other) {
+    if (this != &other) {
+        FrameBuffer copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+FrameBuffer& FrameBuffer::operator=(FrameBuffer&& other) noexcept {
+    if (this != &other) {
+        Reset();
+        m_Mat = std::move(other.m_Mat);
+        m_Slot = other.m_Slot;
+        m_Pool = std::move(other.m_Pool);
+        other.m_Slot = nullptr;
+    }
+    return *this;
+}
+
+FrameBuffer::~FrameBuffer() { Reset(); }
+
+FrameBuffer FrameBuffer::Allocate(int rows, int cols, int type) {
+    FrameBuffer buffer;
+    buffer.m_Mat.create(rows, cols, type);
+    return buffer;
+}
+
+void FrameBuffer::Reset() {
+    m_Mat.release();  // Only drops the header for pooled buffers
+    if (m_Slot && m_Slot->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        m_Pool->Release(m_Slot);
+    }
+    m_Slot = nullptr;
+    m_Pool.reset();
+}
+
+FramePool::FramePool(const FramePoolSpecification& spec) : m_Specification(spec) {
+    ARC_CORE_ASSERT(spec.Capacity > 0 && spec.BufferSize > 0, "Invalid frame pool size!");
+
+    const size_t pageSize = spec.HugePages ? HugePageSize : (size_t)sysconf(_SC_PAGESIZE);
+    m_BufferSize = (spec.BufferSize + pageSize - 1) / pageSize * pageSize;
+    m_MemorySize = m_BufferSize * spec.Capacity;
+
+    // Populated right away: the page faults happen here instead of in the first decodes
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE;
+    void* memory = MAP_FAILED;
+    if (spec.HugePages) {
+        memory = mmap(nullptr, m_MemorySize, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+        if (memory == MAP_FAILED) {
+            // No reserved huge pages; ask for transparent ones instead, before populating
+            memory = mmap(nullptr, m_MemorySize, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (memory != MAP_FAILED) {
+                madvise(memory, m_MemorySize, MADV_HUGEPAGE);
+                memset(memory, 0, m_MemorySize);
+            }
+        }
+    } else {
+        memory = mmap(nullptr, m_MemorySize, PROT_READ | PROT_WRITE, flags, -1, 0);
+    }
+    if (memory == MAP_FAILED) {
+        ARC_CORE_ERROR("Failed to map a frame pool of {0} MB: {1}", m_MemorySize >> 20,
+                       strerror(errno));
+        return;
+    }
+    m_Memory = static_cast<uint8_t*>(memory);
+
+    m_Slots.resize(spec.Capacity);
+    m_FreeSlots.reserve(spec.Capacity);
+    for (uint32_t i = 0; i < spec.Capacity; i++) {
+        m_Slots[i].Data = m_Memory + (size_t)i * m_BufferSize;
+        m_Slots[i].Index = i;
+        m_FreeSlots.push_back(spec.Capacity - 1 - i);  // Hand out the first buffer first
+    }
+}
+
+FramePool::~FramePool() {
+    // Every handle holds a reference to the pool, so all buffers are back by now
+    if (m_Memory) {
+        munmap(m_Memory, m_MemorySize);
+    }
+}
+
+uint32_t FramePool::GetAvailableCount() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return (uint32_t)m_FreeSlots.size();
+}
+
+FrameBuffer FramePool::Acquire(int rows, int cols, int type) {
+    FrameBuffer buffer;
+    const size_t size = (size_t)rows * cols * CV_ELEM_SIZE(type);
+    if (!m_Memory || size > m_BufferSize) {
+        return buffer;
+    }
+
+    FrameBuffer::Slot* slot;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_FreeSlots.empty()) {
+            return buffer;
+        }
+        slot = &m_Slots[m_FreeSlots.back()];
+        m_FreeSlots.pop_back();
+    }
+
+    slot->RefCount.store(1, std::memory_order_relaxed);
+    buffer.m_Mat = cv::Mat(rows, cols, type, slot->Data);
+    buffer.m_Slot = slot;
+    buffer.m_Pool = shared_from_this();
+    return buffer;
+}
+
+void FramePool::Release(FrameBuffer::Slot* slot) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_FreeSlots.push_back(slot->Index);
+}
+
+}  // namespace ARcane
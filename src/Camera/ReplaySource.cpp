@@ -0,0 +1,139 @@
+#include "ARcane/Camera/ReplaySource.hpp"
+
+namespace ARcane {
+
+static uint64_t Fnv1a(uint64_t hash, const uint8_t* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+ReplaySource::ReplaySource(const std::string& path)
+    : m_Reader(path), m_Running(false), m_Finished(false) {
+    if (m_Reader.IsOpen()) {
+        ARC_CORE_INFO("Loaded recording '{0}': {1} frames, {2:.1f} s", path,
+                      m_Reader.GetRecordCount(), m_Reader.GetDurationNs() / 1e9);
+    }
+}
+
+ReplaySource::~ReplaySource() { Stop(); }
+
+void ReplaySource::Start(CameraStream& stream, ReplayMode mode, bool loop) {
+    Stop();
+    if (!m_Reader.IsOpen() || m_Reader.GetRecordCount() == 0) {
+        ARC_CORE_WARN("Nothing to replay from '{0}'", m_Reader.GetPath());
+        m_Finished = true;
+        return;
+    }
+    if (stream.IsReceiving()) {
+        ARC_CORE_ERROR("Cannot replay '{0}' into a stream that is already receiving",
+                       m_Reader.GetPath());
+        m_Finished = true;
+        return;
+    }
+
+    m_FramesDecoded = 0;
+    m_FramesRateLimited = 0;
+    m_DecodeFailures = 0;
+    m_FramesRendered = 0;
+    m_DecodeNs = 0;
+    m_InputChecksum = 0;
+    m_EndNs = 0;
+
+    m_Finished = false;
+    m_Running = true;
+    m_StartTime = std::chrono::steady_clock::now();
+    m_ReplayThread = std::thread(&ReplaySource::ReplayLoop, this, std::ref(stream), mode, loop);
+}
+
+void ReplaySource::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_StopMutex);
+        m_Running = false;
+    }
+    m_StopCondition.notify_all();
+    if (m_ReplayThread.joinable()) {
+        m_ReplayThread.join();
+    }
+}
+
+ReplaySource::Statistics ReplaySource::GetStats() const {
+    Statistics stats;
+    stats.FramesDecoded = m_FramesDecoded;
+    stats.FramesRateLimited = m_FramesRateLimited;
+    stats.DecodeFailures = m_DecodeFailures;
+    stats.FramesRendered = m_FramesRendered;
+    stats.DecodeSeconds = m_DecodeNs / 1e9;
+    stats.InputChecksum = m_InputChecksum;
+
+    uint64_t endNs = m_EndNs;
+    stats.WallSeconds = endNs ? endNs / 1e9
+                              : std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                              m_StartTime)
+                                    .count();
+    return stats;
+}
+
+void ReplaySource::ReplayLoop(CameraStream& stream, ReplayMode mode, bool loop) {
+    using namespace std::chrono;
+
+    uint64_t checksum = 0xcbf29ce484222325ull;
+
+    do {
+        const auto passStart = steady_clock::now();
+        const uint64_t firstTimestamp = m_Reader.GetRecord(0).TimestampNs;
+
+        for (size_t i = 0; i < m_Reader.GetRecordCount() && m_Running; i++) {
+            const SessionReader::Record& record = m_Reader.GetRecord(i);
+
+            if (mode == ReplayMode::Realtime) {
+                // Records can be far apart: a wait Stop() can interrupt, not a sleep
+                auto deadline = passStart + nanoseconds(record.TimestampNs - firstTimestamp);
+                std::unique_lock<std::mutex> lock(m_StopMutex);
+                if (m_StopCondition.wait_until(lock, deadline, [this] { return !m_Running; })) {
+                    break;
+                }
+            }
+
+            auto decodeStart = steady_clock::now();
+            uint64_t rateLimited = stream.GetRateLimitedCount();
+            bool decoded = stream.PushFrame(record.Data, record.Size);
+            m_DecodeNs += duration_cast<nanoseconds>(steady_clock::now() - decodeStart).count();
+
+            checksum = Fnv1a(checksum, record.Data, record.Size);
+            m_InputChecksum = checksum;
+
+            // A frame the stream's rate limit skipped is not a failure, and never reaches the
+            // renderer, so lockstep must not wait for it either
+            if (!decoded) {
+                if (stream.GetRateLimitedCount() != rateLimited) {
+                    m_FramesRateLimited++;
+                } else {
+                    m_DecodeFailures++;
+                }
+                continue;
+            }
+            m_FramesDecoded++;
+
+            if (mode == ReplayMode::AsFastAsPossible) {
+                // Lockstep: wait for the renderer so no frame is skipped or shown twice
+                while (m_Running && !stream.WaitForFrameConsumed(milliseconds(100))) {
+                }
+                if (m_Running) m_FramesRendered++;
+            }
+        }
+    } while (loop && m_Running);
+
+    m_EndNs = duration_cast<nanoseconds>(steady_clock::now() - m_StartTime).count();
+    m_Finished = true;
+
+    Statistics stats = GetStats();
+    ARC_CORE_INFO("Replay of '{0}' done: {1} frames decoded at {2:.1f} fps, rendered at "
+                  "{3:.1f} fps, checksum {4:016x}",
+                  m_Reader.GetPath(), stats.FramesDecoded, stats.GetDecodeFPS(),
+                  stats.GetRenderFPS(), stats.InputChecksum);
+}
+
+}  // namespace ARcane
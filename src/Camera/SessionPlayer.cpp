@@ -0,0 +1,142 @@
+#include "ARcane/Camera/SessionPlayer.hpp"
+#include <opencv2/imgcodecs.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace ARcane {
+
+SessionPlayer::SessionPlayer(const std::string& path, uint32_t cacheSize)
+    : m_Reader(path), m_CacheSize(std::max(cacheSize, 1u)), m_Target(0), m_Running(false) {
+    if (!IsOpen()) return;
+
+    m_PositionNs = m_Reader.GetStartNs();
+    m_Running = true;
+    m_DecodeThread = std::thread(&SessionPlayer::DecodeLoop, this);
+}
+
+SessionPlayer::~SessionPlayer() {
+    {
+        std::lock_guard<std::mutex> lock(m_CacheMutex);
+        m_Running = false;
+    }
+    m_TargetCondition.notify_one();
+    if (m_DecodeThread.joinable()) {
+        m_DecodeThread.join();
+    }
+}
+
+void SessionPlayer::Seek(uint64_t timestampNs) {
+    if (!IsOpen()) return;
+
+    m_PositionNs = std::clamp(timestampNs, m_Reader.GetStartNs(), m_Reader.GetEndNs());
+    SetTarget(m_Reader.FindRecord(m_PositionNs));
+}
+
+void SessionPlayer::SeekToRecord(size_t index) {
+    if (!IsOpen()) return;
+
+    // By index rather than through Seek(): records can share a timestamp, and looking one up by
+    // time would always land on the last of them
+    index = std::min(index, m_Reader.GetRecordCount() - 1);
+    m_PositionNs = m_Reader.GetRecord(index).TimestampNs;
+    SetTarget(index);
+}
+
+void SessionPlayer::Step(int frames) {
+    m_Playing = false;
+    SeekToRecord((size_t)std::max<int64_t>((int64_t)m_Target + frames, 0));
+}
+
+void SessionPlayer::SetTarget(size_t index) {
+    if (index == m_Target) return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_CacheMutex);
+        m_Target = index;
+    }
+    m_TargetCondition.notify_one();
+}
+
+void SessionPlayer::OnUpdate(Timestep ts) {
+    if (!m_Playing || !IsOpen()) return;
+
+    Seek(m_PositionNs + (uint64_t)(ts.GetSeconds() * m_Speed * 1e9));
+    if (m_PositionNs >= m_Reader.GetEndNs()) {
+        m_Playing = false;
+    }
+}
+
+cv::Mat SessionPlayer::GetFrame() const {
+    // Cached frames are never written again once decoded, so sharing them needs no clone
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    auto it = m_Cache.find(m_Reader.FindKeyframe(m_Target));
+    if (it != m_Cache.end()) {
+        m_Shown = it->second;
+    }
+    return m_Shown;
+}
+
+size_t SessionPlayer::GetCachedCount() const {
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    return m_Cache.size();
+}
+
+void SessionPlayer::DecodeLoop() {
+    const size_t recordCount = m_Reader.GetRecordCount();
+    const size_t behind = m_CacheSize / 4;  // Most of the cache goes to frames ahead
+    const size_t ahead = m_CacheSize - behind;
+
+    size_t served = SIZE_MAX;
+    std::vector<size_t> order;
+    order.reserve(m_CacheSize);
+
+    while (true) {
+        size_t target;
+        {
+            std::unique_lock<std::mutex> lock(m_CacheMutex);
+            m_TargetCondition.wait(lock, [&] { return !m_Running || m_Target != served; });
+            if (!m_Running) return;
+            target = m_Target;
+
+            // Forget frames outside the new window so the cache stays bounded
+            size_t first = target > behind ? target - behind : 0;
+            size_t last = std::min(target + ahead, recordCount);
+            for (auto it = m_Cache.begin(); it != m_Cache.end();) {
+                it = (it->first < first || it->first >= last) ? m_Cache.erase(it) : std::next(it);
+            }
+        }
+        served = target;
+        m_Reader.Prefetch(target, PrefetchRecords);
+
+        // The position first, then ahead in playback order, then behind for stepping back.
+        // JPEG records are all keyframes; other records are shown as their keyframe.
+        order.clear();
+        for (size_t i = target; i < std::min(target + ahead, recordCount); i++) {
+            order.push_back(m_Reader.FindKeyframe(i));
+        }
+        for (size_t i = 1; i <= behind && i <= target; i++) {
+            order.push_back(m_Reader.FindKeyframe(target - i));
+        }
+
+        for (size_t index : order) {
+            if (!m_Running || m_Target != target) break;  // Moved: restart from the new position
+
+            {
+                std::lock_guard<std::mutex> lock(m_CacheMutex);
+                if (m_Cache.count(index)) continue;
+            }
+
+            const SessionReader::Record& record = m_Reader.GetRecord(index);
+            cv::Mat buffer(1, (int)record.Size, CV_8UC1, const_cast<uint8_t*>(record.Data));
+            cv::Mat frame = cv::imdecode(buffer, cv::IMREAD_COLOR);
+            if (frame.empty()) continue;
+            m_DecodedCount++;
+
+            std::lock_guard<std::mutex> lock(m_CacheMutex);
+            m_Cache[index] = frame;
+        }
+    }
+}
+
+}  // namespace ARcane
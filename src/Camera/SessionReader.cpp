@@ -0,0 +1,174 @@
+#include "ARcane/Camera/SessionReader.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+namespace ARcane {
+
+SessionReader::SessionReader(const std::string& path) : m_Path(path) {
+    int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0) {
+        ARC_CORE_ERROR("Failed to open recording '{0}': {1}", path, strerror(errno));
+        return;
+    }
+
+    struct stat info;
+    if (fstat(file, &info) == 0 && (size_t)info.st_size >= SessionBlockSize) {
+        void* mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (mapping != MAP_FAILED) {
+            m_Mapping = static_cast<const uint8_t*>(mapping);
+            m_MappingSize = info.st_size;
+        } else {
+            ARC_CORE_ERROR("Failed to map recording '{0}': {1}", path, strerror(errno));
+        }
+    } else {
+        ARC_CORE_ERROR("Recording '{0}' is empty", path);
+    }
+    close(file);  // The mapping keeps the file alive
+
+    if (!m_Mapping) return;
+
+    SessionFileHeader header;
+    memcpy(&header, m_Mapping, sizeof(header));
+    if (header.Magic != SessionFileMagic || header.BlockSize != SessionBlockSize) {
+        ARC_CORE_ERROR("'{0}' is not an ARcane recording", path);
+        munmap((void*)m_Mapping, m_MappingSize);
+        m_Mapping = nullptr;
+        return;
+    }
+
+    m_HasIndex = ReadIndex();
+    if (!m_HasIndex) {
+        ARC_CORE_WARN("Recording '{0}' has no index, rebuilding it by scanning", path);
+        ScanChunks();
+    }
+
+    for (size_t i = 0; i < m_Records.size(); i++) {
+        if (m_Records[i].Flags & SessionRecordKeyframe) {
+            m_Keyframes.push_back((uint32_t)i);
+        }
+    }
+
+    auto byTimestamp = [](const Record& a, const Record& b) {
+        return a.TimestampNs < b.TimestampNs;
+    };
+    m_Sorted = std::is_sorted(m_Records.begin(), m_Records.end(), byTimestamp);
+    if (!m_Records.empty()) {
+        auto [first, last] = std::minmax_element(m_Records.begin(), m_Records.end(), byTimestamp);
+        m_StartNs = first->TimestampNs;
+        m_EndNs = last->TimestampNs;
+    }
+    if (!m_Sorted) {
+        ARC_CORE_WARN("Recording '{0}' has timestamps going backwards, seeking scans linearly",
+                      path);
+    }
+}
+
+SessionReader::~SessionReader() {
+    if (m_Mapping) {
+        munmap((void*)m_Mapping, m_MappingSize);
+    }
+}
+
+bool SessionReader::ReadIndex() {
+    if (m_MappingSize < 2 * SessionBlockSize) return false;
+
+    SessionIndexFooter footer;
+    memcpy(&footer, m_Mapping + m_MappingSize - sizeof(footer), sizeof(footer));
+    if (footer.Magic != SessionIndexMagic || footer.IndexOffset < SessionBlockSize ||
+        footer.IndexOffset > m_MappingSize ||
+        footer.EntryCount > (m_MappingSize - footer.IndexOffset) / sizeof(SessionIndexEntry)) {
+        return false;
+    }
+
+    m_Records.reserve(footer.EntryCount);
+    const uint8_t* entries = m_Mapping + footer.IndexOffset;
+    for (uint64_t i = 0; i < footer.EntryCount; i++) {
+        SessionIndexEntry entry;
+        memcpy(&entry, entries + i * sizeof(entry), sizeof(entry));
+
+        const uint64_t payload = entry.Offset + sizeof(SessionRecordHeader);
+        if (payload + entry.Size > footer.IndexOffset) {
+            m_Records.clear();
+            return false;
+        }
+        m_Records.push_back({entry.TimestampNs, m_Mapping + payload, entry.Size, entry.Flags});
+    }
+    return true;
+}
+
+void SessionReader::ScanChunks() {
+    uint64_t offset = SessionBlockSize;
+
+    while (offset + sizeof(SessionChunkHeader) <= m_MappingSize) {
+        SessionChunkHeader chunk;
+        memcpy(&chunk, m_Mapping + offset, sizeof(chunk));
+
+        // Anything else (or a chunk running past the end) means the file stops here
+        if (chunk.Magic != SessionChunkMagic || chunk.ChunkBytes == 0 ||
+            offset + chunk.ChunkBytes > m_MappingSize ||
+            sizeof(SessionChunkHeader) + chunk.PayloadBytes > chunk.ChunkBytes) {
+            break;
+        }
+
+        const uint8_t* cursor = m_Mapping + offset + sizeof(SessionChunkHeader);
+        const uint8_t* end = cursor + chunk.PayloadBytes;
+        for (uint32_t i = 0; i < chunk.RecordCount; i++) {
+            SessionRecordHeader record;
+            if (cursor + sizeof(record) > end) break;
+            memcpy(&record, cursor, sizeof(record));
+            cursor += sizeof(record);
+
+            if (cursor + record.Size > end) break;
+            m_Records.push_back({record.TimestampNs, cursor, record.Size, record.Flags});
+            cursor += record.Size;
+        }
+
+        offset += chunk.ChunkBytes;
+    }
+}
+
+size_t SessionReader::FindRecord(uint64_t timestampNs) const {
+    if (!m_Sorted) {
+        size_t found = 0;
+        for (size_t i = 0; i < m_Records.size(); i++) {
+            if (m_Records[i].TimestampNs <= timestampNs) found = i;
+        }
+        return found;
+    }
+
+    auto it = std::upper_bound(
+        m_Records.begin(), m_Records.end(), timestampNs,
+        [](uint64_t timestamp, const Record& record) { return timestamp < record.TimestampNs; });
+    return it == m_Records.begin() ? 0 : (size_t)(it - m_Records.begin()) - 1;
+}
+
+size_t SessionReader::FindKeyframe(size_t index) const {
+    // Recordings made before keyframes were flagged only contain JPEGs
+    if (m_Keyframes.empty()) return index;
+
+    auto it = std::upper_bound(m_Keyframes.begin(), m_Keyframes.end(), (uint32_t)index);
+    return it == m_Keyframes.begin() ? 0 : *(it - 1);
+}
+
+void SessionReader::Prefetch(size_t first, size_t count) const {
+    if (first >= m_Records.size() || count == 0) return;
+    size_t last = std::min(first + count, m_Records.size()) - 1;
+
+    // madvise wants a page-aligned start; the mapping itself is page-aligned
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    uintptr_t begin = (uintptr_t)m_Records[first].Data & ~(uintptr_t)(pageSize - 1);
+    uintptr_t end = (uintptr_t)(m_Records[last].Data + m_Records[last].Size);
+    madvise((void*)begin, end - begin, MADV_WILLNEED);
+}
+
+uint64_t SessionReader::GetDurationNs() const {
+    return m_EndNs - m_StartNs;
+}
+
+}  // namespace ARcane
@@ -0,0 +1,244 @@
+#include "ARcane/Camera/SessionRecorder.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+namespace ARcane {
+
+static uint64_t AlignToBlock(uint64_t size) {
+    return (size + SessionBlockSize - 1) / SessionBlockSize * SessionBlockSize;
+}
+
+uint64_t SessionRecorder::Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+SessionRecorder::SessionRecorder(const std::string& path, uint32_t chunkSize, uint32_t chunkCount)
+    : m_Path(path), m_ChunkSize((uint32_t)AlignToBlock(chunkSize)), m_Running(false) {
+    ARC_CORE_ASSERT(chunkCount >= 2, "SessionRecorder needs at least two chunks!");
+
+    m_File = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (m_File < 0) {
+        ARC_CORE_ERROR("Failed to create recording '{0}': {1}", path, strerror(errno));
+        return;
+    }
+
+    // The file header occupies a whole block so that every chunk starts aligned
+    auto* header = static_cast<uint8_t*>(std::aligned_alloc(SessionBlockSize, SessionBlockSize));
+    memset(header, 0, SessionBlockSize);
+    SessionFileHeader fileHeader;
+    fileHeader.CreatedNs = Now();
+    memcpy(header, &fileHeader, sizeof(fileHeader));
+    bool written = WriteAll(header, SessionBlockSize);
+    std::free(header);
+    if (!written) {
+        close(m_File);
+        m_File = -1;
+        return;
+    }
+
+    m_Chunks.resize(chunkCount);
+    for (auto& chunk : m_Chunks) {
+        chunk.Data = static_cast<uint8_t*>(std::aligned_alloc(SessionBlockSize, m_ChunkSize));
+        m_FreeChunks.push_back(&chunk);
+    }
+    m_Index.reserve(64 * 1024);  // About half an hour at 30 fps before the first reallocation
+
+    m_Running = true;
+    m_WriterThread = std::thread(&SessionRecorder::WriterLoop, this);
+}
+
+SessionRecorder::~SessionRecorder() {
+    Stop();
+    for (auto& chunk : m_Chunks) {
+        std::free(chunk.Data);
+    }
+}
+
+bool SessionRecorder::Append(const void* data, uint32_t size, uint64_t timestampNs,
+                             uint32_t flags) {
+    std::lock_guard<std::mutex> lock(m_AppendMutex);  // Uncontended unless Stop() races
+    if (!m_Running) return false;
+
+    const uint64_t recordSize = sizeof(SessionRecordHeader) + size;
+    if (sizeof(SessionChunkHeader) + recordSize > m_ChunkSize) {
+        ARC_CORE_ERROR("SessionRecorder: {0} byte frame does not fit in a chunk", size);
+        m_DroppedCount++;
+        return false;
+    }
+
+    // Start a new chunk if this record does not fit or the current one is getting old
+    if (m_Current && (m_Current->Used + recordSize > m_ChunkSize ||
+                      std::chrono::steady_clock::now() - m_Current->Started > FlushInterval)) {
+        SubmitChunk();
+    }
+    if (!m_Current && !AcquireChunk()) {
+        // The writer is behind and every chunk is queued: drop rather than block the caller
+        m_DroppedCount++;
+        return false;
+    }
+
+    SessionRecordHeader record;
+    record.TimestampNs = timestampNs;
+    record.Size = size;
+    record.Flags = flags;
+
+    SessionIndexEntry entry;
+    entry.TimestampNs = timestampNs;
+    entry.Offset = m_Current->FileOffset + m_Current->Used;
+    entry.Size = size;
+    entry.Flags = flags;
+    m_Index.push_back(entry);
+
+    uint8_t* dst = m_Current->Data + m_Current->Used;
+    memcpy(dst, &record, sizeof(record));
+    memcpy(dst + sizeof(record), data, size);
+    m_Current->Used += recordSize;
+    m_Current->RecordCount++;
+
+    m_RecordedCount++;
+    return true;
+}
+
+bool SessionRecorder::AcquireChunk() {
+    std::lock_guard<std::mutex> lock(m_ChunkMutex);
+    if (m_FreeChunks.empty()) return false;
+
+    m_Current = m_FreeChunks.back();
+    m_FreeChunks.pop_back();
+    m_Current->Used = sizeof(SessionChunkHeader);
+    m_Current->RecordCount = 0;
+    m_Current->FileOffset = m_NextChunkOffset;  // The writer writes chunks in submission order
+    m_Current->Started = std::chrono::steady_clock::now();
+    return true;
+}
+
+void SessionRecorder::SubmitChunk() {
+    m_NextChunkOffset += AlignToBlock(m_Current->Used);
+    {
+        std::lock_guard<std::mutex> lock(m_ChunkMutex);
+        m_FullChunks.push_back(m_Current);
+    }
+    m_Current = nullptr;
+    m_ChunkCondition.notify_one();
+}
+
+void SessionRecorder::SubmitStaleChunk() {
+    // Only tries: Stop() holds the append mutex while it joins the writer thread
+    std::unique_lock<std::mutex> lock(m_AppendMutex, std::try_to_lock);
+    if (!lock.owns_lock() || !m_Running) return;
+
+    if (m_Current && m_Current->RecordCount > 0 &&
+        std::chrono::steady_clock::now() - m_Current->Started > FlushInterval) {
+        SubmitChunk();
+    }
+}
+
+void SessionRecorder::Stop() {
+    std::lock_guard<std::mutex> appendLock(m_AppendMutex);
+    if (!m_Running) return;
+
+    // Write whatever is left in the current chunk
+    if (m_Current && m_Current->RecordCount > 0) {
+        SubmitChunk();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_ChunkMutex);
+        m_Running = false;
+    }
+    m_ChunkCondition.notify_one();
+    m_WriterThread.join();
+
+    WriteIndex();
+    close(m_File);
+    m_File = -1;
+    ARC_CORE_INFO("Recorded {0} frames ({1} dropped) to '{2}'", m_RecordedCount.load(),
+                  m_DroppedCount.load(), m_Path);
+}
+
+void SessionRecorder::WriterLoop() {
+    while (true) {
+        Chunk* chunk = nullptr;
+        {
+            // Wakes up at least every FlushInterval, so the partial chunk of a stream that
+            // stopped sending still reaches the disk
+            std::unique_lock<std::mutex> lock(m_ChunkMutex);
+            m_ChunkCondition.wait_for(lock, FlushInterval,
+                                      [this] { return !m_Running || !m_FullChunks.empty(); });
+            if (!m_FullChunks.empty()) {
+                chunk = m_FullChunks.front();
+                m_FullChunks.pop_front();
+            } else if (!m_Running) {
+                return;  // Stopped and drained
+            }
+        }
+        if (!chunk) {
+            SubmitStaleChunk();
+            continue;
+        }
+
+        // Fill in the header and zero the padding up to the next block boundary
+        const uint64_t chunkBytes = AlignToBlock(chunk->Used);
+        SessionChunkHeader header;
+        header.RecordCount = chunk->RecordCount;
+        header.PayloadBytes = chunk->Used - sizeof(SessionChunkHeader);
+        header.ChunkBytes = chunkBytes;
+        memcpy(chunk->Data, &header, sizeof(header));
+        memset(chunk->Data + chunk->Used, 0, chunkBytes - chunk->Used);
+
+        if (WriteAll(chunk->Data, chunkBytes)) {
+            m_BytesWritten += chunkBytes;
+        } else {
+            m_DroppedCount += chunk->RecordCount;
+            m_WriteFailed = true;
+        }
+
+        std::lock_guard<std::mutex> lock(m_ChunkMutex);
+        m_FreeChunks.push_back(chunk);
+    }
+}
+
+void SessionRecorder::WriteIndex() {
+    if (m_WriteFailed) {
+        ARC_CORE_WARN("Not writing an index for '{0}', readers will scan the file", m_Path);
+        return;
+    }
+
+    // The footer ends exactly on a block boundary, so the file stays block-aligned
+    const uint64_t indexBytes = m_Index.size() * sizeof(SessionIndexEntry);
+    const uint64_t totalBytes = AlignToBlock(indexBytes + sizeof(SessionIndexFooter));
+    auto* buffer = static_cast<uint8_t*>(std::aligned_alloc(SessionBlockSize, totalBytes));
+    memcpy(buffer, m_Index.data(), indexBytes);
+    memset(buffer + indexBytes, 0, totalBytes - indexBytes);
+
+    SessionIndexFooter footer;
+    footer.EntryCount = m_Index.size();
+    footer.IndexOffset = m_NextChunkOffset;
+    memcpy(buffer + totalBytes - sizeof(footer), &footer, sizeof(footer));
+
+    if (WriteAll(buffer, totalBytes)) {
+        m_BytesWritten += totalBytes;
+    }
+    std::free(buffer);
+}
+
+bool SessionRecorder::WriteAll(const uint8_t* data, uint64_t size) {
+    while (size > 0) {
+        ssize_t written = write(m_File, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            ARC_CORE_ERROR("Failed to write recording '{0}': {1}", m_Path, strerror(errno));
+            return false;
+        }
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+}  // namespace ARcane
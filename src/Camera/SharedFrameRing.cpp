@@ -0,0 +1,269 @@
+#include "ARcane/Camera/SharedFrameRing.hpp"
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <new>
+
+namespace ARcane {
+
+static_assert(sizeof(std::atomic_uint32_t) == sizeof(uint32_t), "Futex word must be 32 bits");
+
+// Shared (not FUTEX_PRIVATE) futexes: the writer and readers are different processes
+static void FutexWait(std::atomic_uint32_t& word, uint32_t expected,
+                      std::chrono::milliseconds timeout) {
+    timespec duration;
+    duration.tv_sec = timeout.count() / 1000;
+    duration.tv_nsec = (timeout.count() % 1000) * 1'000'000;
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, &duration,
+            nullptr, 0);
+}
+
+static void FutexWakeAll(std::atomic_uint32_t& word) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr,
+            0);
+}
+
+static std::string GetObjectName(const std::string& name) {
+    return name.empty() || name[0] != '/' ? "/" + name : name;
+}
+
+SharedFrameWriter::SharedFrameWriter(const std::string& name, uint32_t slotCount,
+                                     uint32_t slotSize)
+    : m_Name(GetObjectName(name)) {
+    ARC_CORE_ASSERT(slotCount > 1 && slotSize > 0, "Invalid shared frame ring size!");
+
+    const uint64_t stride =
+        (sizeof(SharedSlotHeader) + slotSize + alignof(SharedSlotHeader) - 1) &
+        ~(uint64_t)(alignof(SharedSlotHeader) - 1);
+    const size_t size = SharedRingHeaderSize + stride * slotCount;
+
+    // Replace a ring left behind by a writer that crashed. Its readers never see it closed, but
+    // notice the name refers to a new object (SharedFrameReader::IsStale()) and reopen.
+    shm_unlink(m_Name.c_str());
+    int file = shm_open(m_Name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (file < 0) {
+        ARC_CORE_ERROR("Failed to create shared memory '{0}': {1}", m_Name, strerror(errno));
+        return;
+    }
+
+    void* mapping = MAP_FAILED;
+    if (ftruncate(file, (off_t)size) == 0) {
+        mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    }
+    close(file);  // The mapping keeps the object alive
+    if (mapping == MAP_FAILED) {
+        ARC_CORE_ERROR("Failed to map shared memory '{0}': {1}", m_Name, strerror(errno));
+        shm_unlink(m_Name.c_str());
+        return;
+    }
+
+    m_Mapping = static_cast<uint8_t*>(mapping);
+    m_MappingSize = size;
+
+    // Fresh pages are zeroed, so every slot starts at Version 0 (no frame)
+    m_Header = new (m_Mapping) SharedRingHeader();
+    m_Header->SlotCount = slotCount;
+    m_Header->SlotSize = slotSize;
+    m_Header->SlotStride = stride;
+    m_Header->Closed = 0;
+    m_Header->WriteSequence = 0;
+    m_Header->Notify = 0;
+    m_Header->Waiters = 0;
+    for (uint32_t i = 0; i < slotCount; i++) {
+        new (GetSlot(i)) SharedSlotHeader();
+    }
+
+    // Readers check the magic last, after everything else is in place
+    m_Header->Version = SharedRingVersion;
+    std::atomic_thread_fence(std::memory_order_release);
+    m_Header->Magic.store(SharedRingMagic, std::memory_order_release);
+}
+
+SharedFrameWriter::~SharedFrameWriter() {
+    if (!m_Mapping) return;
+
+    m_Header->Closed.store(1, std::memory_order_release);
+    m_Header->Notify.fetch_add(1);
+    FutexWakeAll(m_Header->Notify);
+
+    munmap(m_Mapping, m_MappingSize);
+    shm_unlink(m_Name.c_str());  // Readers keep their mappings until they close them
+}
+
+SharedSlotHeader* SharedFrameWriter::GetSlot(uint64_t sequence) const {
+    uint64_t index = sequence % m_Header->SlotCount;
+    return reinterpret_cast<SharedSlotHeader*>(m_Mapping + SharedRingHeaderSize +
+                                               index * m_Header->SlotStride);
+}
+
+uint8_t* SharedFrameWriter::BeginFrame() {
+    SharedSlotHeader* slot = GetSlot(m_Sequence);
+
+    // Odd: readers still using the previous frame of this slot will see the change. The fence
+    // keeps the payload writes below from becoming visible before it.
+    slot->Version.store(2 * m_Sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return reinterpret_cast<uint8_t*>(slot + 1);
+}
+
+void SharedFrameWriter::CommitFrame(const FrameHeader& header, size_t size) {
+    ARC_CORE_ASSERT(size <= m_Header->SlotSize, "Frame larger than a shared ring slot!");
+
+    SharedSlotHeader* slot = GetSlot(m_Sequence);
+    slot->Size = size;
+    slot->Header = header;
+    slot->Version.store(2 * m_Sequence + 2, std::memory_order_release);
+
+    m_Sequence++;
+    m_Header->WriteSequence.store(m_Sequence, std::memory_order_release);
+
+    // Pairs with the Waiters increment in SharedFrameReader::Wait(): either the reader sees the
+    // new WriteSequence, or this sees the waiter and wakes it
+    m_Header->Notify.fetch_add(1, std::memory_order_seq_cst);
+    if (m_Header->Waiters.load(std::memory_order_seq_cst) > 0) {
+        FutexWakeAll(m_Header->Notify);
+    }
+}
+
+bool SharedFrameWriter::Publish(const FrameHeader& header, const void* data, size_t size) {
+    if (size > m_Header->SlotSize) {
+        ARC_CORE_ERROR("Frame of {0} bytes does not fit in '{1}' ({2} byte slots)", size, m_Name,
+                       m_Header->SlotSize);
+        return false;
+    }
+
+    memcpy(BeginFrame(), data, size);
+    CommitFrame(header, size);
+    return true;
+}
+
+SharedFrameReader::SharedFrameReader(const std::string& name) : m_ObjectName(GetObjectName(name)) {
+    const std::string& objectName = m_ObjectName;
+    int file = shm_open(objectName.c_str(), O_RDWR | O_CLOEXEC, 0);
+    if (file < 0) {
+        // Usually the writer has not started yet; the caller retries
+        return;
+    }
+
+    struct stat info;
+    void* mapping = MAP_FAILED;
+    if (fstat(file, &info) == 0 && (size_t)info.st_size > SharedRingHeaderSize) {
+        mapping = mmap(nullptr, info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    }
+    close(file);
+    if (mapping == MAP_FAILED) {
+        return;
+    }
+
+    auto* header = static_cast<SharedRingHeader*>(mapping);
+    if (header->Magic.load(std::memory_order_acquire) != SharedRingMagic ||
+        header->Version != SharedRingVersion ||
+        SharedRingHeaderSize + header->SlotStride * header->SlotCount > (size_t)info.st_size) {
+        ARC_CORE_ERROR("'{0}' is not an ARcane frame ring (or is still being created)",
+                       objectName);
+        munmap(mapping, info.st_size);
+        return;
+    }
+
+    m_Mapping = static_cast<uint8_t*>(mapping);
+    m_MappingSize = info.st_size;
+    m_Header = header;
+    m_Inode = info.st_ino;
+
+    // Start with the newest frame, so something shows up right away
+    uint64_t written = m_Header->WriteSequence.load(std::memory_order_acquire);
+    m_Next = written ? written - 1 : 0;
+}
+
+SharedFrameReader::~SharedFrameReader() {
+    if (m_Mapping) {
+        munmap(m_Mapping, m_MappingSize);
+    }
+}
+
+bool SharedFrameReader::IsStale() const {
+    if (IsClosed()) return true;
+
+    int file = shm_open(m_ObjectName.c_str(), O_RDONLY | O_CLOEXEC, 0);
+    if (file < 0) {
+        return errno == ENOENT;  // Removed; a writer that comes back creates a new one
+    }
+    struct stat info;
+    bool replaced = fstat(file, &info) == 0 && (uint64_t)info.st_ino != m_Inode;
+    close(file);
+    return replaced;
+}
+
+bool SharedFrameReader::Wait(std::chrono::milliseconds timeout) {
+    if (m_Header->WriteSequence.load(std::memory_order_acquire) > m_Next) return true;
+
+    m_Header->Waiters.fetch_add(1, std::memory_order_seq_cst);
+    uint32_t notify = m_Header->Notify.load(std::memory_order_seq_cst);
+    if (m_Header->WriteSequence.load(std::memory_order_seq_cst) <= m_Next && !IsClosed()) {
+        FutexWait(m_Header->Notify, notify, timeout);
+    }
+    m_Header->Waiters.fetch_sub(1, std::memory_order_seq_cst);
+
+    return m_Header->WriteSequence.load(std::memory_order_acquire) > m_Next;
+}
+
+bool SharedFrameReader::ReadSlot(uint64_t sequence, Frame& frame) const {
+    const auto* slot = reinterpret_cast<const SharedSlotHeader*>(
+        m_Mapping + SharedRingHeaderSize + (sequence % m_Header->SlotCount) * m_Header->SlotStride);
+
+    const uint64_t version = slot->Version.load(std::memory_order_acquire);
+    if (version != 2 * sequence + 2) {
+        return false;  // Not written yet, being rewritten or already overwritten
+    }
+
+    frame.Data = reinterpret_cast<const uint8_t*>(slot + 1);
+    frame.Size = slot->Size;
+    frame.Header = slot->Header;
+    frame.Sequence = sequence;
+    return frame.Size <= m_Header->SlotSize && IsValid(frame);
+}
+
+bool SharedFrameReader::Acquire(Frame& frame, uint64_t& skipped) {
+    const uint64_t first = m_Next;
+    const uint64_t slotCount = m_Header->SlotCount;
+
+    // Two attempts: if the writer laps the reader while it decides, it restarts from the newest
+    for (int attempt = 0; attempt < 2; attempt++) {
+        const uint64_t written = m_Header->WriteSequence.load(std::memory_order_acquire);
+        if (m_Next >= written) return false;
+
+        const uint64_t newest = written - 1;
+        uint64_t target = m_Next;
+        Frame latest;
+        if (newest - m_Next >= slotCount - 1) {
+            target = newest;  // Lapped, or about to be
+        } else if (newest > m_Next && ReadSlot(newest, latest) && latest.Header.IsKeyframe()) {
+            target = newest;  // Everything before a keyframe is obsolete
+        }
+
+        if (ReadSlot(target, frame)) {
+            skipped = target - first;
+            m_Next = target + 1;
+            return true;
+        }
+        m_Next = newest;
+    }
+    return false;
+}
+
+bool SharedFrameReader::IsValid(const Frame& frame) const {
+    const auto* slot = reinterpret_cast<const SharedSlotHeader*>(frame.Data) - 1;
+
+    // Orders the reads of the payload (and header copy) before the second version check
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot->Version.load(std::memory_order_relaxed) == 2 * frame.Sequence + 2;
+}
+
+}  // namespace ARcane
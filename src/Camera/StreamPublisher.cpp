@@ -0,0 +1,154 @@
+#include "ARcane/Camera/StreamPublisher.hpp"
+#include "ARcane/Core/Application.hpp"
+#include <opencv2/imgcodecs.hpp>
+
+namespace ARcane {
+
+StreamPublisher::StreamPublisher(const StreamPublisherSpecification& spec)
+    : m_Specification(spec),
+      m_JpegQuality(spec.JpegQuality),
+      m_Running(false),
+      m_Context(1),
+      m_Publisher(m_Context, ZMQ_PUB) {
+    ARC_CORE_ASSERT(spec.Workers > 0, "StreamPublisher needs at least one worker!");
+
+    m_Readback = CreateRef<AsyncReadback>();
+    m_Readback->SetMaxFrameRate(spec.FrameRate);
+    m_Readback->SetCallback([this](const uint8_t* pixels, uint32_t width, uint32_t height,
+                                   uint64_t frameIndex) {
+        OnFrameReadBack(pixels, width, height, frameIndex);
+    });
+
+    try {
+        m_Publisher.set(zmq::sockopt::linger, 0);
+        m_Publisher.bind(spec.Url);
+    } catch (const zmq::error_t& e) {
+        ARC_CORE_ERROR("Failed to bind publisher to {}: {}", spec.Url, (const char*)e.what());
+    }
+}
+
+StreamPublisher::~StreamPublisher() {
+    Stop();
+    m_Publisher.close();
+    m_Context.close();
+}
+
+void StreamPublisher::Start() {
+    if (m_Running) return;
+
+    m_Running = true;
+    for (uint32_t i = 0; i < m_Specification.Workers; i++) {
+        m_Workers.emplace_back(&StreamPublisher::WorkerLoop, this);
+    }
+    Application::Get().AttachReadback(m_Readback);
+}
+
+void StreamPublisher::Stop() {
+    if (!m_Running) return;
+
+    Application::Get().DetachReadback(m_Readback);
+    {
+        std::lock_guard<std::mutex> lock(m_JobMutex);
+        m_Running = false;
+    }
+    m_JobCondition.notify_all();
+
+    for (auto& worker : m_Workers) {
+        worker.join();
+    }
+    m_Workers.clear();
+    m_Jobs.clear();
+    m_JobsInFlight = 0;
+}
+
+void StreamPublisher::SetFrameRate(float fps) { m_Readback->SetMaxFrameRate(fps); }
+
+void StreamPublisher::OnFrameReadBack(const uint8_t* pixels, uint32_t width, uint32_t height,
+                                      uint64_t frameIndex) {
+    Job job;
+    {
+        std::lock_guard<std::mutex> lock(m_JobMutex);
+
+        // Every worker is busy: drop this frame instead of back-pressuring the render loop
+        if (m_JobsInFlight >= m_Specification.Workers) {
+            m_DroppedCount++;
+            return;
+        }
+        m_JobsInFlight++;
+
+        if (!m_FreePixels.empty()) {
+            job.Pixels = std::move(m_FreePixels.back());
+            m_FreePixels.pop_back();
+        }
+    }
+
+    // The mapped buffer is only valid during this call, so the pixels are copied out here.
+    // create() is a no-op when a recycled buffer already has the right size.
+    job.Pixels.create((int)height, (int)width, CV_8UC4);
+    memcpy(job.Pixels.data, pixels, (size_t)width * height * 4);
+    job.FrameIndex = frameIndex;
+
+    {
+        std::lock_guard<std::mutex> lock(m_JobMutex);
+        m_Jobs.push_back(std::move(job));
+    }
+    m_JobCondition.notify_one();
+}
+
+void StreamPublisher::WorkerLoop() {
+    cv::Mat bgr;
+    std::vector<uchar> jpeg;
+
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_JobMutex);
+            m_JobCondition.wait(lock, [this] { return !m_Running || !m_Jobs.empty(); });
+            if (!m_Running) return;
+
+            job = std::move(m_Jobs.front());
+            m_Jobs.pop_front();
+        }
+
+        // OpenGL rows are bottom-up and RGBA, JPEG wants top-down BGR
+        cv::cvtColor(job.Pixels, bgr, cv::COLOR_RGBA2BGR);
+        cv::flip(bgr, bgr, 0);
+
+        const std::vector<int> params = {cv::IMWRITE_JPEG_QUALITY, m_JpegQuality.load()};
+        bool encoded = cv::imencode(".jpg", bgr, jpeg, params);
+
+        {
+            std::lock_guard<std::mutex> lock(m_JobMutex);
+            m_FreePixels.push_back(std::move(job.Pixels));
+            m_JobsInFlight--;
+        }
+
+        if (encoded) {
+            Publish(jpeg, job.FrameIndex);
+        } else {
+            ARC_CORE_ERROR("StreamPublisher: failed to encode frame {0}", job.FrameIndex);
+        }
+    }
+}
+
+void StreamPublisher::Publish(const std::vector<uchar>& jpeg, uint64_t frameIndex) {
+    std::lock_guard<std::mutex> lock(m_PublisherMutex);
+
+    // A newer frame finished encoding first, this one is stale
+    if (m_PublishedCount > 0 && frameIndex <= m_LastPublishedIndex) {
+        m_DroppedCount++;
+        return;
+    }
+
+    try {
+        // PUB sockets never block: a subscriber past its high-water mark misses this frame
+        // without the others being held up, and without the send reporting it
+        m_Publisher.send(zmq::buffer(jpeg.data(), jpeg.size()), zmq::send_flags::dontwait);
+        m_LastPublishedIndex = frameIndex;
+        m_PublishedCount++;
+    } catch (const zmq::error_t& e) {
+        ARC_CORE_ERROR("ZMQ Error: {}", (const char*)e.what());
+    }
+}
+
+}  // namespace ARcane
@@ -0,0 +1,134 @@
+#include "ARcane/Camera/StreamStats.hpp"
+
+#include <algorithm>
+
+namespace ARcane {
+
+static constexpr uint64_t NsPerSecond = 1'000'000'000;
+
+const char* GetFrameDropReasonName(FrameDropReason reason) {
+    switch (reason) {
+        case FrameDropReason::Lost: return "lost";
+        case FrameDropReason::Skipped: return "skipped";
+        case FrameDropReason::RateLimited: return "rate_limited";
+        case FrameDropReason::DecodeFailed: return "decode_failed";
+        case FrameDropReason::WaitingForKeyframe: return "waiting_for_keyframe";
+        default: return "unknown";
+    }
+}
+
+void RateCounter::Add(uint64_t nowNs, uint64_t bytes) {
+    // Seconds are numbered from 1 so that a zeroed bucket is never mistaken for a current one
+    const uint64_t second = nowNs / NsPerSecond + 1;
+    if (m_FirstSecond.load(std::memory_order_relaxed) == 0) {
+        m_FirstSecond.store(second, std::memory_order_relaxed);
+    }
+
+    Bucket& bucket = m_Buckets[second % m_Buckets.size()];
+    if (bucket.Second.load(std::memory_order_relaxed) != second) {
+        // Only the writer resets. Second is invalid while the counts are cleared, so a reader
+        // that read them meanwhile sees it change and drops the bucket.
+        bucket.Second.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bucket.Count.store(0, std::memory_order_relaxed);
+        bucket.Bytes.store(0, std::memory_order_relaxed);
+        bucket.Second.store(second, std::memory_order_release);
+    }
+    bucket.Count.fetch_add(1, std::memory_order_relaxed);
+    bucket.Bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+uint64_t RateCounter::Sum(uint64_t nowNs, uint64_t& count, uint64_t& bytes) const {
+    const uint64_t second = nowNs / NsPerSecond + 1;
+    count = 0;
+    bytes = 0;
+
+    // The first second started part way through, so it is left out. Until WindowSeconds complete
+    // seconds have passed, the average is over the ones that did.
+    const uint64_t firstSecond = m_FirstSecond.load(std::memory_order_relaxed);
+    if (firstSecond == 0 || second <= firstSecond + 1) return 0;
+
+    for (const Bucket& bucket : m_Buckets) {
+        uint64_t bucketSecond = bucket.Second.load(std::memory_order_acquire);
+        if (bucketSecond <= firstSecond || bucketSecond >= second ||
+            bucketSecond + WindowSeconds < second) {
+            continue;
+        }
+
+        uint64_t bucketCount = bucket.Count.load(std::memory_order_relaxed);
+        uint64_t bucketBytes = bucket.Bytes.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (bucket.Second.load(std::memory_order_relaxed) != bucketSecond) continue;  // Reset
+        count += bucketCount;
+        bytes += bucketBytes;
+    }
+    return std::min<uint64_t>(second - firstSecond - 1, WindowSeconds);
+}
+
+double RateCounter::GetRate(uint64_t nowNs) const {
+    uint64_t count, bytes;
+    uint64_t seconds = Sum(nowNs, count, bytes);
+    return seconds ? (double)count / seconds : 0.0;
+}
+
+double RateCounter::GetByteRate(uint64_t nowNs) const {
+    uint64_t count, bytes;
+    uint64_t seconds = Sum(nowNs, count, bytes);
+    return seconds ? (double)bytes / seconds : 0.0;
+}
+
+void StreamStats::RecordReceived(size_t bytes, uint64_t nowNs) {
+    m_ReceivedCount.fetch_add(1, std::memory_order_relaxed);
+    m_ReceivedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    m_LastReceiveNs.store(nowNs, std::memory_order_relaxed);
+    m_ReceiveRate.Add(nowNs, bytes);
+}
+
+void StreamStats::RecordDecoded(uint64_t decodeTimeNs, uint64_t nowNs) {
+    m_DecodedCount.fetch_add(1, std::memory_order_relaxed);
+    m_LastDecodeNs.store(nowNs, std::memory_order_relaxed);
+    m_DecodeRate.Add(nowNs);
+    m_DecodeTime.Record(decodeTimeNs / 1000);
+}
+
+void StreamStats::RecordDropped(FrameDropReason reason, uint64_t count) {
+    m_DroppedCount[(size_t)reason].fetch_add(count, std::memory_order_relaxed);
+}
+
+void StreamStats::RecordTransportError() {
+    m_TransportErrorCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+StreamStats::Snapshot StreamStats::GetSnapshot(uint64_t nowNs) const {
+    Snapshot snapshot;
+    snapshot.ReceivedCount = m_ReceivedCount.load(std::memory_order_relaxed);
+    snapshot.DecodedCount = m_DecodedCount.load(std::memory_order_relaxed);
+    snapshot.ReceivedBytes = m_ReceivedBytes.load(std::memory_order_relaxed);
+    snapshot.TransportErrorCount = m_TransportErrorCount.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < snapshot.DroppedCount.size(); i++) {
+        snapshot.DroppedCount[i] = m_DroppedCount[i].load(std::memory_order_relaxed);
+    }
+
+    snapshot.ReceiveFps = m_ReceiveRate.GetRate(nowNs);
+    snapshot.DecodeFps = m_DecodeRate.GetRate(nowNs);
+    snapshot.Bitrate = m_ReceiveRate.GetByteRate(nowNs) * 8.0;
+
+    snapshot.DecodeTimeP50Us = m_DecodeTime.GetPercentile(50.0);
+    snapshot.DecodeTimeP99Us = m_DecodeTime.GetPercentile(99.0);
+    snapshot.DecodeTimeMaxUs = m_DecodeTime.GetMax();
+
+    // Frames stamped by another thread may be a little newer than nowNs
+    uint64_t lastReceiveNs = m_LastReceiveNs.load(std::memory_order_relaxed);
+    if (lastReceiveNs) {
+        snapshot.LastReceiveAgeMs =
+            nowNs > lastReceiveNs ? (double)(nowNs - lastReceiveNs) / 1e6 : 0.0;
+    }
+    uint64_t lastDecodeNs = m_LastDecodeNs.load(std::memory_order_relaxed);
+    if (lastDecodeNs) {
+        snapshot.LastDecodeAgeMs =
+            nowNs > lastDecodeNs ? (double)(nowNs - lastDecodeNs) / 1e6 : 0.0;
+    }
+    return snapshot;
+}
+
+}  // namespace ARcane
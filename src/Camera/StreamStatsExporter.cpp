@@ -0,0 +1,115 @@
+#include "ARcane/Camera/StreamStatsExporter.hpp"
+
+#include <algorithm>
+
+namespace ARcane {
+
+// Names are user supplied: escape what would break the JSON string
+static void WriteJsonString(std::ostream& out, const std::string& value) {
+    out << '"';
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if ((unsigned char)c < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned)c);
+            out << escaped;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+StreamStatsExporter::StreamStatsExporter(const std::string& path,
+                                         std::chrono::milliseconds interval)
+    : m_Path(path), m_File(path, std::ios::app), m_Interval(interval), m_Running(false) {
+    if (!m_File.is_open()) {
+        ARC_CORE_ERROR("Failed to open stream stats file '{0}'", path);
+        return;
+    }
+    m_Running = true;
+    m_ExportThread = std::thread(&StreamStatsExporter::ExportLoop, this);
+}
+
+StreamStatsExporter::~StreamStatsExporter() { Stop(); }
+
+void StreamStatsExporter::AddStream(const std::string& name, const CameraStream& stream) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Streams.push_back({name, &stream});
+}
+
+void StreamStatsExporter::RemoveStream(const CameraStream& stream) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Streams.erase(std::remove_if(m_Streams.begin(), m_Streams.end(),
+                                   [&](const Entry& entry) { return entry.Stream == &stream; }),
+                    m_Streams.end());
+}
+
+void StreamStatsExporter::Stop() {
+    if (!m_Running) return;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Running = false;
+    }
+    m_Condition.notify_one();
+    m_ExportThread.join();
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    Export();
+    m_File.close();
+}
+
+void StreamStatsExporter::ExportLoop() {
+    auto next = std::chrono::steady_clock::now() + m_Interval;
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (m_Running) {
+        if (m_Condition.wait_until(lock, next, [this] { return !m_Running; })) break;
+
+        Export();
+        // Fixed schedule rather than sleeping a full interval after each export, so the lines
+        // stay evenly spaced; skips ahead if the thread was held up for several intervals
+        next += m_Interval;
+        auto now = std::chrono::steady_clock::now();
+        if (next < now) next = now + m_Interval;
+    }
+}
+
+void StreamStatsExporter::Export() {
+    if (m_Streams.empty()) return;
+
+    // Stats are kept on the steady clock; the exported time is wall clock for correlation
+    const uint64_t now = GetSteadyClockNs();
+    const uint64_t wallNow = GetWallClockNs();
+    for (const Entry& entry : m_Streams) {
+        StreamStats::Snapshot stats = entry.Stream->GetStats().GetSnapshot(now);
+
+        m_File << "{\"time_ns\":" << wallNow << ",\"stream\":";
+        WriteJsonString(m_File, entry.Name);
+        m_File << ",\"received\":" << stats.ReceivedCount << ",\"decoded\":" << stats.DecodedCount
+               << ",\"received_bytes\":" << stats.ReceivedBytes
+               << ",\"transport_errors\":" << stats.TransportErrorCount
+               << ",\"receive_fps\":" << stats.ReceiveFps << ",\"decode_fps\":" << stats.DecodeFps
+               << ",\"bitrate\":" << stats.Bitrate
+               << ",\"decode_time_p50_us\":" << stats.DecodeTimeP50Us
+               << ",\"decode_time_p99_us\":" << stats.DecodeTimeP99Us
+               << ",\"decode_time_max_us\":" << stats.DecodeTimeMaxUs
+               << ",\"last_receive_age_ms\":" << stats.LastReceiveAgeMs
+               << ",\"last_decode_age_ms\":" << stats.LastDecodeAgeMs << ",\"dropped\":{";
+        for (size_t i = 0; i < stats.DroppedCount.size(); i++) {
+            if (i > 0) m_File << ',';
+            WriteJsonString(m_File, GetFrameDropReasonName((FrameDropReason)i));
+            m_File << ':' << stats.DroppedCount[i];
+        }
+        m_File << "}}\n";
+    }
+    // One flush per export, so a tail -f or a crash sees whole lines
+    m_File.flush();
+    if (!m_File) {
+        ARC_CORE_WARN("Failed to write stream stats to '{0}'", m_Path);
+        m_File.clear();
+    }
+    m_ExportCount++;
+}
+
+}  // namespace ARcane
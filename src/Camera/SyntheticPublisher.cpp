@@ -0,0 +1,377 @@
+#include "ARcane/Camera/SyntheticPublisher.hpp"
+#include "ARcane/Camera/FrameHeader.hpp"
+#include "ARcane/Camera/FrameDecoder.hpp"
+#include "ARcane/Camera/VideoDecoder.hpp"
+#include <opencv2/imgcodecs.hpp>
+
+#ifdef ARC_HAS_LIBAV
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavutil/imgutils.h>
+#include <libavutil/opt.h>
+}
+#endif
+
+#include <cstring>
+
+namespace ARcane {
+
+SyntheticPublisher::SyntheticPublisher(const SyntheticPublisherSpecification& spec,
+                                       zmq::context_t* context)
+    : m_Specification(spec),
+      m_OwnedContext(context ? nullptr : CreateScope<zmq::context_t>(1)),
+      m_Publisher(context ? *context : *m_OwnedContext, ZMQ_PUB),
+      m_Running(false) {
+    // Without frames the publish loop stops straight away and Verify() fails
+    bool evenSize = spec.Width % 2 == 0 && spec.Height % 2 == 0;
+    if (spec.Width == 0 || spec.Height == 0 || !(spec.FrameRate > 0.0f) || spec.BurstSize == 0 ||
+        spec.UniqueFrames == 0 || (IsInterFrameEncoding(spec.Encoding) && !evenSize)) {
+        ARC_CORE_ERROR("Invalid SyntheticPublisher specification: {0}x{1} at {2} fps, bursts of "
+                       "{3}, {4} unique frames", spec.Width, spec.Height, spec.FrameRate,
+                       spec.BurstSize, spec.UniqueFrames);
+        return;
+    }
+    if (IsInterFrameEncoding(spec.Encoding) && !spec.SendHeader) {
+        ARC_CORE_WARN("SyntheticPublisher: video frames are always sent with a header");
+        m_Specification.SendHeader = true;
+    }
+
+    static const std::string sharedMemoryScheme = "shm://";
+    bool sharedMemory = spec.Url.compare(0, sharedMemoryScheme.size(), sharedMemoryScheme) == 0;
+    if (!sharedMemory) {
+        try {
+            m_Publisher.set(zmq::sockopt::linger, 0);
+            m_Publisher.bind(spec.Url);
+        } catch (const zmq::error_t& e) {
+            ARC_CORE_ERROR("Failed to bind synthetic publisher to {}: {}", spec.Url,
+                           (const char*)e.what());
+        }
+    }
+
+    GenerateFrames();
+
+    // The ring is sized for the largest generated frame
+    if (sharedMemory && !m_Frames.empty()) {
+        size_t largest = 0;
+        for (const auto& frame : m_Frames) {
+            largest = std::max(largest, frame.size());
+        }
+        m_SharedWriter = CreateScope<SharedFrameWriter>(spec.Url.substr(sharedMemoryScheme.size()),
+                                                        SharedRingSlotCount, (uint32_t)largest);
+        if (!m_SharedWriter->IsOpen()) {
+            m_SharedWriter.reset();
+            m_Frames.clear();
+        }
+    }
+}
+
+SyntheticPublisher::~SyntheticPublisher() {
+    Stop();
+    m_Publisher.close();
+    if (m_OwnedContext) {
+        m_OwnedContext->close();
+    }
+}
+
+void SyntheticPublisher::Start() {
+    if (m_Running) return;
+
+    m_Running = true;
+    m_PublishThread = std::thread(&SyntheticPublisher::PublishLoop, this);
+}
+
+void SyntheticPublisher::Stop() {
+    m_Running = false;
+    if (m_PublishThread.joinable()) {
+        m_PublishThread.join();
+    }
+}
+
+void SyntheticPublisher::DrawFrame(cv::Mat& image, uint32_t index) const {
+    const int width = image.cols;
+    const int height = image.rows;
+
+    // Scrolling gradient with a moving bar, so consecutive frames differ like real video
+    for (int y = 0; y < height; y++) {
+        uchar* row = image.ptr(y);
+        for (int x = 0; x < width; x++) {
+            row[x * 3 + 0] = (uchar)((x + index * 8) & 0xFF);
+            row[x * 3 + 1] = (uchar)((y + index * 4) & 0xFF);
+            row[x * 3 + 2] = (uchar)((x + y) & 0xFF);
+        }
+    }
+    int barX = (int)((uint64_t)index * width / m_Specification.UniqueFrames);
+    cv::rectangle(image, cv::Rect(barX, 0, std::max(width / 32, 1), height),
+                  cv::Scalar(255, 255, 255), -1);
+    cv::putText(image, std::to_string(index), cv::Point(20, height / 2), cv::FONT_HERSHEY_SIMPLEX,
+                height / 180.0, cv::Scalar(0, 0, 0), std::max(height / 180, 1));
+}
+
+void SyntheticPublisher::GenerateFrames() {
+    const int width = (int)m_Specification.Width;
+    const int height = (int)m_Specification.Height;
+
+    if (IsInterFrameEncoding(m_Specification.Encoding)) {
+        if (!EncodeVideo()) {
+            m_Frames.clear();
+            m_Keyframes.clear();
+        }
+    } else {
+        const std::vector<int> params = {cv::IMWRITE_JPEG_QUALITY, m_Specification.JpegQuality};
+
+        cv::Mat image(height, width, CV_8UC3);
+        std::vector<uchar> jpeg;
+        m_Frames.resize(m_Specification.UniqueFrames);
+        m_Keyframes.assign(m_Specification.UniqueFrames, true);
+
+        for (uint32_t i = 0; i < m_Specification.UniqueFrames; i++) {
+            DrawFrame(image, i);
+            if (!cv::imencode(".jpg", image, jpeg, params) || jpeg.size() < 2) {
+                ARC_CORE_ERROR("SyntheticPublisher: failed to encode frame {0}", i);
+                m_Frames.clear();
+                m_Keyframes.clear();
+                break;
+            }
+
+            // Make room for the stamp segment after the SOI marker (FF D8)
+            std::vector<uchar>& frame = m_Frames[i];
+            frame.resize(jpeg.size() + JpegStamp::SegmentSize);
+            frame[0] = jpeg[0];
+            frame[1] = jpeg[1];
+            JpegStamp::WriteSegment(frame.data() + 2);
+            memcpy(frame.data() + 2 + JpegStamp::SegmentSize, jpeg.data() + 2, jpeg.size() - 2);
+        }
+    }
+
+    ARC_CORE_INFO("SyntheticPublisher: {0} frames of {1}x{2}, {3} KB on average",
+                  m_Frames.size(), width, height,
+                  m_Frames.empty() ? 0 : m_Frames[m_Frames.size() / 2].size() / 1024);
+}
+
+#ifdef ARC_HAS_LIBAV
+
+bool SyntheticPublisher::EncodeVideo() {
+    // 4:2:0 planes are half the size in both directions
+    if ((m_Specification.Width & 1) || (m_Specification.Height & 1)) {
+        ARC_CORE_ERROR("SyntheticPublisher: video frames need an even size, not {0}x{1}",
+                       m_Specification.Width, m_Specification.Height);
+        return false;
+    }
+
+    const bool hevc = m_Specification.Encoding == FrameEncoding::H265;
+    const AVCodec* codec = avcodec_find_encoder(hevc ? AV_CODEC_ID_HEVC : AV_CODEC_ID_H264);
+    if (!codec) {
+        ARC_CORE_ERROR("SyntheticPublisher: libavcodec has no {0} encoder",
+                       hevc ? "H.265" : "H.264");
+        return false;
+    }
+
+    AVCodecContext* context = avcodec_alloc_context3(codec);
+    if (!context) {
+        ARC_CORE_ERROR("SyntheticPublisher: failed to allocate the {0} encoder", codec->name);
+        return false;
+    }
+    context->width = (int)m_Specification.Width;
+    context->height = (int)m_Specification.Height;
+    context->pix_fmt = AV_PIX_FMT_YUV420P;
+    context->time_base = {1, std::max((int)m_Specification.FrameRate, 1)};
+    context->framerate = {std::max((int)m_Specification.FrameRate, 1), 1};
+    context->bit_rate = m_Specification.VideoBitrate;
+    context->gop_size = std::max((int)m_Specification.KeyframeInterval, 1);
+    context->max_b_frames = 0;  // Decode order = send order, one frame out per frame in
+
+    // x264/x265 options; other encoders ignore them
+    av_opt_set(context->priv_data, "preset", "ultrafast", 0);
+    av_opt_set(context->priv_data, "tune", "zerolatency", 0);
+    av_opt_set_int(context->priv_data, "forced-idr", 1, 0);
+
+    AVFrame* frame = av_frame_alloc();
+    AVPacket* packet = av_packet_alloc();
+    bool ok = avcodec_open2(context, codec, nullptr) >= 0;
+    if (!ok) {
+        ARC_CORE_ERROR("SyntheticPublisher: failed to open the {0} encoder", codec->name);
+    }
+
+    auto receivePackets = [&]() {
+        while (avcodec_receive_packet(context, packet) == 0) {
+            m_Frames.emplace_back(packet->data, packet->data + packet->size);
+            m_Keyframes.push_back((packet->flags & AV_PKT_FLAG_KEY) != 0);
+            av_packet_unref(packet);
+        }
+    };
+
+    cv::Mat image((int)m_Specification.Height, (int)m_Specification.Width, CV_8UC3);
+    cv::Mat yuv;
+    for (uint32_t i = 0; ok && i < m_Specification.UniqueFrames; i++) {
+        DrawFrame(image, i);
+        cv::cvtColor(image, yuv, cv::COLOR_BGR2YUV_I420);  // Y, U, V planes back to back
+
+        frame->format = context->pix_fmt;
+        frame->width = context->width;
+        frame->height = context->height;
+        av_image_fill_arrays(frame->data, frame->linesize, yuv.data, context->pix_fmt,
+                             context->width, context->height, 1);
+        frame->pts = i;
+        // The cycle restarts at frame 0, which must not reference the end of the sequence
+        frame->pict_type = (i % context->gop_size == 0) ? AV_PICTURE_TYPE_I : AV_PICTURE_TYPE_NONE;
+
+        ok = avcodec_send_frame(context, frame) >= 0;
+        receivePackets();
+    }
+    if (ok) {
+        avcodec_send_frame(context, nullptr);  // Drain
+        receivePackets();
+    }
+
+    av_packet_free(&packet);
+    av_frame_free(&frame);
+    avcodec_free_context(&context);
+
+    if (ok && (m_Frames.size() != m_Specification.UniqueFrames || !m_Keyframes[0])) {
+        ARC_CORE_ERROR("SyntheticPublisher: {0} did not produce one packet per frame starting "
+                       "with a keyframe",
+                       codec->name);
+        ok = false;
+    }
+    return ok;
+}
+
+#else
+
+bool SyntheticPublisher::EncodeVideo() {
+    ARC_CORE_ERROR("SyntheticPublisher: H.264/H.265 needs ARcane built with libavcodec");
+    return false;
+}
+
+#endif
+
+bool SyntheticPublisher::Verify() const {
+    if (m_Frames.empty()) {
+        ARC_CORE_ERROR("SyntheticPublisher: no frames to verify");
+        return false;
+    }
+
+    // Decoded with what CameraStream uses, and compared with the frames before encoding
+    const bool video = IsInterFrameEncoding(m_Specification.Encoding);
+    Scope<FrameDecoder> frameDecoder = video ? nullptr : FrameDecoder::Create();
+    Scope<VideoDecoder> videoDecoder = video ? VideoDecoder::Create(m_Specification.Encoding)
+                                             : nullptr;
+    if (video && !videoDecoder) return false;
+
+    const int width = (int)m_Specification.Width;
+    const int height = (int)m_Specification.Height;
+    cv::Mat image(height, width, CV_8UC3), reference, decoded;
+    uint32_t matching = 0;
+    double worstError = 0.0;
+
+    for (uint32_t i = 0; i < m_Frames.size(); i++) {
+        const std::vector<uchar>& frame = m_Frames[i];
+        bool ok;
+        if (video) {
+            // Low delay decoding: every access unit comes out as soon as it goes in
+            ok = videoDecoder->Decode(frame.data(), frame.size(), decoded) &&
+                 decoded.cols == width && decoded.rows == height + height / 2;
+        } else {
+            JpegStamp stamp;
+            ok = JpegStamp::Parse(frame.data(), frame.size(), stamp) &&
+                 frameDecoder->Decode(frame.data(), frame.size(), DecodeOptions(), decoded) &&
+                 decoded.cols == width && decoded.rows == height;
+        }
+        if (!ok) {
+            ARC_CORE_ERROR("SyntheticPublisher: frame {0} did not decode to {1}x{2}", i, width,
+                           height);
+            continue;
+        }
+
+        // Mean absolute error per sample, in the decoded layout
+        DrawFrame(image, i);
+        if (video) {
+            cv::cvtColor(image, reference, cv::COLOR_BGR2YUV_I420);
+        } else {
+            reference = image;
+        }
+        double error = cv::norm(decoded, reference, cv::NORM_L1) /
+                       ((double)decoded.total() * decoded.channels());
+        worstError = std::max(worstError, error);
+        if (error <= MaxVerifyError) {
+            matching++;
+        }
+    }
+
+    ARC_CORE_INFO("SyntheticPublisher: {0} of {1} frames decoded back within tolerance, worst "
+                  "mean error {2:.2f}",
+                  matching, m_Frames.size(), worstError);
+    return matching == m_Frames.size();
+}
+
+void SyntheticPublisher::PublishLoop() {
+    using namespace std::chrono;
+
+    const auto burstPeriod = duration_cast<steady_clock::duration>(
+        duration<double>(m_Specification.BurstSize / m_Specification.FrameRate));
+    auto nextBurst = steady_clock::now();
+    uint64_t sequence = 0;
+
+    const bool stamped = !IsInterFrameEncoding(m_Specification.Encoding);
+    if (m_Frames.empty()) {
+        m_Running = false;
+    }
+
+    while (m_Running) {
+        for (uint32_t i = 0; i < m_Specification.BurstSize && m_Running; i++) {
+            if (m_Specification.FrameCount && sequence >= m_Specification.FrameCount) {
+                m_Running = false;
+                break;
+            }
+
+            const size_t index = sequence % m_Frames.size();
+            const std::vector<uchar>& source = m_Frames[index];
+            zmq::message_t message(source.data(), source.size());
+
+            // Stamp right before sending so the timestamp excludes queueing in this loop
+            uint64_t now = GetWallClockNs();
+            if (stamped) {
+                JpegStamp stamp;
+                stamp.Sequence = sequence;
+                stamp.TimestampNs = now;
+                stamp.Write(message.data<uint8_t>());
+            }
+
+            FrameHeader header;
+            header.Encoding = m_Specification.Encoding;
+            header.Flags = m_Keyframes[index] ? FrameHeaderKeyframe : 0;
+            header.Sequence = sequence++;
+            header.CaptureTimestampNs = now;
+            header.Width = m_Specification.Width;
+            header.Height = m_Specification.Height;
+            header.CameraId = m_Specification.CameraId;
+
+            if (m_SharedWriter) {
+                m_SharedWriter->Publish(header, message.data(), message.size());
+                m_SentCount++;
+                m_BytesSent += source.size();
+                continue;
+            }
+
+            try {
+                // PUB never blocks: a subscriber past its high-water mark misses the frame without
+                // holding up the others. The sender is not told, subscribers see the gap in the
+                // sequence numbers (CameraStream::GetLostCount()).
+                if (m_Specification.SendHeader) {
+                    m_Publisher.send(zmq::buffer(&header, sizeof(header)),
+                                     zmq::send_flags::sndmore | zmq::send_flags::dontwait);
+                }
+                m_Publisher.send(message, zmq::send_flags::dontwait);
+                m_SentCount++;
+                m_BytesSent += source.size();
+            } catch (const zmq::error_t& e) {
+                ARC_CORE_ERROR("ZMQ Error: {}", (const char*)e.what());
+            }
+        }
+
+        nextBurst += burstPeriod;
+        std::this_thread::sleep_until(nextBurst);
+    }
+}
+
+}  // namespace ARcane
@@ -0,0 +1,159 @@
+#include "ARcane/Camera/VideoDecoder.hpp"
+
+#ifdef ARC_HAS_LIBAV
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavutil/imgutils.h>
+}
+#endif
+
+#include <cstring>
+
+namespace ARcane {
+
+#ifdef ARC_HAS_LIBAV
+
+static std::string GetErrorString(int error) {
+    char buffer[AV_ERROR_MAX_STRING_SIZE] = {};
+    av_strerror(error, buffer, sizeof(buffer));
+    return buffer;
+}
+
+Scope<VideoDecoder> VideoDecoder::Create(FrameEncoding encoding,
+                                         const VideoDecoderSettings& settings) {
+    AVCodecID id;
+    switch (encoding) {
+        case FrameEncoding::H264: id = AV_CODEC_ID_H264; break;
+        case FrameEncoding::H265: id = AV_CODEC_ID_HEVC; break;
+        default: return nullptr;
+    }
+
+    const AVCodec* codec = avcodec_find_decoder(id);
+    if (!codec) {
+        ARC_CORE_ERROR("libavcodec has no decoder for {0}", avcodec_get_name(id));
+        return nullptr;
+    }
+
+    Scope<VideoDecoder> decoder(new VideoDecoder());
+    decoder->m_Context = avcodec_alloc_context3(codec);
+    decoder->m_Packet = av_packet_alloc();
+    decoder->m_Frame = av_frame_alloc();
+    if (!decoder->m_Context || !decoder->m_Packet || !decoder->m_Frame) {
+        return nullptr;
+    }
+
+    AVCodecContext* context = decoder->m_Context;
+    context->thread_count = (int)settings.ThreadCount;
+    if (settings.LowDelay) {
+        context->thread_type = FF_THREAD_SLICE;
+        context->flags |= AV_CODEC_FLAG_LOW_DELAY;
+    } else {
+        context->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+    }
+
+    int result = avcodec_open2(context, codec, nullptr);
+    if (result < 0) {
+        ARC_CORE_ERROR("Failed to open {0} decoder: {1}", codec->name, GetErrorString(result));
+        return nullptr;
+    }
+    return decoder;
+}
+
+VideoDecoder::~VideoDecoder() {
+    av_frame_free(&m_Frame);
+    av_packet_free(&m_Packet);
+    avcodec_free_context(&m_Context);
+}
+
+const char* VideoDecoder::GetName() const { return m_Context->codec->name; }
+
+bool VideoDecoder::Decode(const void* data, size_t size, cv::Mat& output) {
+    // The bitstream readers may read up to AV_INPUT_BUFFER_PADDING_SIZE bytes past the end, which
+    // a message buffer does not guarantee. Copying the compressed payload is cheap.
+    m_PacketBuffer.resize(size + AV_INPUT_BUFFER_PADDING_SIZE);
+    memcpy(m_PacketBuffer.data(), data, size);
+    memset(m_PacketBuffer.data() + size, 0, AV_INPUT_BUFFER_PADDING_SIZE);
+
+    m_Packet->data = m_PacketBuffer.data();
+    m_Packet->size = (int)size;
+    int result = avcodec_send_packet(m_Context, m_Packet);
+    bool decoded = false;
+    if (result == AVERROR(EAGAIN)) {
+        // The decoder's output is full: once its frames are taken, the same packet fits
+        decoded = ReceiveFrames(output);
+        result = avcodec_send_packet(m_Context, m_Packet);
+    }
+    av_packet_unref(m_Packet);
+    if (result < 0) {
+        ARC_CORE_ERROR("{0}: {1}", GetName(), GetErrorString(result));
+        m_ErrorCount++;
+        return decoded;
+    }
+
+    return ReceiveFrames(output) || decoded;
+}
+
+bool VideoDecoder::ReceiveFrames(cv::Mat& output) {
+    // Usually zero or one frame per packet; keep only the newest if the decoder had a backlog
+    bool decoded = false;
+    int result;
+    while ((result = avcodec_receive_frame(m_Context, m_Frame)) == 0) {
+        if (CopyFrame(output)) {
+            decoded = true;
+        } else {
+            m_ErrorCount++;
+        }
+        av_frame_unref(m_Frame);
+    }
+    if (result != AVERROR(EAGAIN) && result != AVERROR_EOF) {
+        ARC_CORE_ERROR("{0}: {1}", GetName(), GetErrorString(result));
+        m_ErrorCount++;
+    }
+    return decoded;
+}
+
+bool VideoDecoder::CopyFrame(cv::Mat& output) {
+    // 4:2:0 8 bit only, which is what cameras and low-latency encoders produce. Full range
+    // (yuvj) frames are shown with limited range levels.
+    auto format = (AVPixelFormat)m_Frame->format;
+    if ((format != AV_PIX_FMT_YUV420P && format != AV_PIX_FMT_YUVJ420P) ||
+        (m_Frame->width & 1) || (m_Frame->height & 1)) {
+        if (!m_FormatWarned) {
+            ARC_CORE_ERROR("{0}: unsupported frame {1}x{2} {3}", GetName(), m_Frame->width,
+                           m_Frame->height, av_get_pix_fmt_name(format));
+            m_FormatWarned = true;
+        }
+        return false;
+    }
+
+    // The planes are packed without row padding, so the frame is one copy out of the decoder's
+    // reference-counted buffers, which go straight back to its pool
+    output.create(m_Frame->height + m_Frame->height / 2, m_Frame->width, CV_8UC1);
+    int result = av_image_copy_to_buffer(output.data, (int)(output.total()), m_Frame->data,
+                                         m_Frame->linesize, format, m_Frame->width,
+                                         m_Frame->height, 1);
+    return result >= 0;
+}
+
+void VideoDecoder::Flush() { avcodec_flush_buffers(m_Context); }
+
+#else
+
+Scope<VideoDecoder> VideoDecoder::Create(FrameEncoding, const VideoDecoderSettings&) {
+    ARC_CORE_ERROR("H.264/H.265 streams need ARcane built with libavcodec");
+    return nullptr;
+}
+
+VideoDecoder::~VideoDecoder() {}
+
+const char* VideoDecoder::GetName() const { return "none"; }
+
+bool VideoDecoder::Decode(const void*, size_t, cv::Mat&) { return false; }
+
+bool VideoDecoder::CopyFrame(cv::Mat&) { return false; }
+
+void VideoDecoder::Flush() {}
+
+#endif
+
+}  // namespace ARcane
@@ -1,19 +1,36 @@
 #include "ARcane/Core/Application.hpp"
 
 #include <GLFW/glfw3.h>
+#include <algorithm>
+#include <cstdlib>
 
 namespace ARcane {
 
 Application* Application::s_Instance = nullptr;
 
-Application::Application() {
+// Lets CI and build machines force a mode without recompiling the client application
+static WindowMode GetWindowModeOverride(WindowMode mode) {
+    const char* env = std::getenv("ARCANE_WINDOW_MODE");
+    if (!env) return mode;
+
+    std::string value = env;
+    if (value == "windowed") return WindowMode::Windowed;
+    if (value == "hidden") return WindowMode::Hidden;
+    if (value == "headless") return WindowMode::Headless;
+
+    ARC_CORE_WARN("Unknown ARCANE_WINDOW_MODE '{0}', ignoring", value);
+    return mode;
+}
+
+Application::Application(WindowMode mode) {
     ARC_CORE_ASSERT(
         !s_Instance,
         "Creating multiple Application instances is not allowed. Use Application::Get() instead.");
     s_Instance = this;
 
     // Create the application window
-    m_Window = CreateScope<Window>(1800, 1200, "ARcane Engine");
+    mode = GetWindowModeOverride(mode);
+    m_Window = CreateScope<Window>(1800, 1200, "ARcane Engine", mode);
 
     // Bind event handling to this application instance
     m_Window->SetEventCallback(ARC_BIND_EVENT_FN(Application::OnEvent));
@@ -21,12 +38,22 @@ Application::Application() {
     Renderer::Init();
     Renderer2D::Init();
 
+    // Without a visible window everything is composed offscreen
+    if (mode != WindowMode::Windowed) {
+        m_Framebuffer = CreateRef<Framebuffer>(
+            FramebufferSpecification{m_Window->GetWidth(), m_Window->GetHeight()});
+    }
+
     // Initialize ImGui
     m_ImGuiLayer = new ImGuiLayer;
     PushOverlay(m_ImGuiLayer);
 }
 
-Application::~Application() {}
+Application::~Application() {
+    // Layers own GL objects and may detach readbacks: release them while the window (and its
+    // context), the framebuffer and m_Readbacks still exist
+    m_LayerStack.Clear();
+}
 
 void Application::PushLayer(Layer* layer) {
     m_LayerStack.PushLayer(layer);
@@ -38,6 +65,17 @@ void Application::PushOverlay(Layer* overlay) {
     overlay->OnAttach();
 }
 
+void Application::AttachReadback(const Ref<AsyncReadback>& readback) {
+    m_Readbacks.push_back(readback);
+}
+
+void Application::DetachReadback(const Ref<AsyncReadback>& readback) {
+    auto it = std::find(m_Readbacks.begin(), m_Readbacks.end(), readback);
+    if (it != m_Readbacks.end()) {
+        m_Readbacks.erase(it);
+    }
+}
+
 void Application::OnEvent(Event& e) {
     EventDispatcher dispatcher(e);
 
@@ -56,28 +94,59 @@ void Application::OnEvent(Event& e) {
 
 void Application::Run() {
     while (m_Running) {
+        ARC_PROFILE_FRAME();
+
         float time = static_cast<float>(glfwGetTime());
         Timestep timestep = time - m_LastFrameTime;
         m_LastFrameTime = time;
 
+        // Renderer statistics are per frame
+        Renderer2D::ResetStats();
+
+        if (m_Framebuffer) {
+            m_Framebuffer->Bind();
+        }
+
         // Update all active layers if the application is not minimized
         if (!m_Minimized) {
+            ARC_PROFILE_SCOPE("Layers OnUpdate");
             for (auto layer : m_LayerStack) {
                 layer->OnUpdate(timestep);
             }
         }
 
         // Render ImGui elements
-        m_ImGuiLayer->Begin();
-        for (auto layer : m_LayerStack) {
-            layer->OnImGuiRender();
+        {
+            ARC_PROFILE_SCOPE("Layers OnImGuiRender");
+            m_ImGuiLayer->Begin();
+            for (auto layer : m_LayerStack) {
+                layer->OnImGuiRender();
+            }
+            m_ImGuiLayer->End();
+        }
+
+        if (m_Framebuffer) {
+            m_Framebuffer->Unbind();
+            m_Framebuffer->Resolve();
+        }
+
+        // Queue reads of the composed frame and deliver the ones that finished earlier
+        for (auto& readback : m_Readbacks) {
+            if (m_Framebuffer) {
+                readback->Capture(*m_Framebuffer);
+            } else {
+                readback->Capture(m_Window->GetWidth(), m_Window->GetHeight());
+            }
+            readback->Poll();
         }
-        m_ImGuiLayer->End();
 
         m_Window->Update();
+        Renderer2D::OnFramePresented();
     }
 }
 
+void Application::Close() { m_Running = false; }
+
 bool Application::OnWindowClose(WindowCloseEvent&) {
     m_Running = false;  // Stop the application loop
     return true;
@@ -91,6 +160,9 @@ bool Application::OnWindowResize(WindowResizeEvent& e) {
     m_Minimized = false;
 
     Renderer::OnWindowResize(e.GetWidth(), e.GetHeight());
+    if (m_Framebuffer) {
+        m_Framebuffer->Resize(e.GetWidth(), e.GetHeight());
+    }
     return false;
 }
 
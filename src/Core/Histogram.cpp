@@ -0,0 +1,71 @@
+#include "ARcane/Core/Histogram.hpp"
+
+#include <cmath>
+
+namespace ARcane {
+
+Histogram::Histogram() { Reset(); }
+
+uint32_t Histogram::GetBucketIndex(uint64_t value) {
+    // Values below 16 get a bucket each, above that 16 buckets per power of two
+    if (value < SubBucketCount) return (uint32_t)value;
+
+    uint32_t exponent = 63 - __builtin_clzll(value);
+    uint32_t mantissa = (uint32_t)(value >> (exponent - SubBucketBits)) & (SubBucketCount - 1);
+    return (exponent - SubBucketBits + 1) * SubBucketCount + mantissa;
+}
+
+uint64_t Histogram::GetBucketUpperBound(uint32_t index) {
+    if (index < SubBucketCount) return index;
+
+    uint32_t exponent = index / SubBucketCount + SubBucketBits - 1;
+    uint64_t mantissa = index % SubBucketCount;
+    uint64_t width = 1ull << (exponent - SubBucketBits);
+    return ((SubBucketCount + mantissa) << (exponent - SubBucketBits)) + (width - 1);
+}
+
+void Histogram::Record(uint64_t value) {
+    m_Buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    m_Count.fetch_add(1, std::memory_order_relaxed);
+    m_Sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t max = m_Max.load(std::memory_order_relaxed);
+    while (value > max && !m_Max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+}
+
+void Histogram::Reset() {
+    for (auto& bucket : m_Buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_Count.store(0, std::memory_order_relaxed);
+    m_Sum.store(0, std::memory_order_relaxed);
+    m_Max.store(0, std::memory_order_relaxed);
+}
+
+double Histogram::GetMean() const {
+    uint64_t count = GetCount();
+    return count ? (double)m_Sum.load(std::memory_order_relaxed) / count : 0.0;
+}
+
+uint64_t Histogram::GetPercentile(double percentile) const {
+    uint64_t count = GetCount();
+    if (count == 0) return 0;
+
+    uint64_t target = (uint64_t)std::ceil(count * percentile / 100.0);
+    if (target == 0) target = 1;
+
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < BucketCount; i++) {
+        seen += m_Buckets[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            // The bucket bound can overshoot the largest sample actually seen
+            uint64_t bound = GetBucketUpperBound(i);
+            uint64_t max = GetMax();
+            return bound < max ? bound : max;
+        }
+    }
+    return GetMax();
+}
+
+}  // namespace ARcane
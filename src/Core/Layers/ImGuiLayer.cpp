@@ -22,7 +22,10 @@ void ImGuiLayer::OnAttach() {
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;  // Enable Keyboard Controls
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;   // Enable Gamepad Controls
     io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;      // Enable Docking
-    io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;    // Enable floating windows
+    // Floating windows need real platform windows
+    if (app.GetWindow().GetMode() == WindowMode::Windowed) {
+        io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;  // Enable floating windows
+    }
 
     ImGui::StyleColorsDark();
     ImGuiStyle& style = ImGui::GetStyle();
@@ -37,9 +40,12 @@ void ImGuiLayer::OnAttach() {
     ImGui_ImplGlfw_InitForOpenGL(window, true);
 
     ImGui_ImplOpenGL3_Init("#version 460");
+
+    m_GPUTimer = CreateScope<GPUTimer>();
 }
 
 void ImGuiLayer::OnDetach() {
+    m_GPUTimer.reset();
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
@@ -60,7 +66,9 @@ void ImGuiLayer::End() {
 
     // Rendering
     ImGui::Render();
+    m_GPUTimer->Begin();
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    m_GPUTimer->End();
 
     if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
         GLFWwindow* backup_current_context = glfwGetCurrentContext();
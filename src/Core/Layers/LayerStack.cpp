@@ -39,4 +39,13 @@ void LayerStack::PopOverlay(Layer* overlay) {
     }
 }
 
+void LayerStack::Clear() {
+    for (auto it = m_Layers.rbegin(); it != m_Layers.rend(); ++it) {
+        (*it)->OnDetach();
+        delete *it;
+    }
+    m_Layers.clear();
+    m_LayerInsertIndex = 0;
+}
+
 }  // namespace ARcane
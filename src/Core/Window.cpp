@@ -12,15 +12,35 @@ static void GLFWErrorCallback(int error, const char* description) {
     ARC_CORE_ERROR("GLFW Error ({0}): {1}", error, description);
 }
 
-Window::Window(uint32_t width, uint32_t height, const char* title)
-    : m_UserStruct(width, height, title) {
+Window::Window(uint32_t width, uint32_t height, const char* title, WindowMode mode)
+    : m_UserStruct(width, height, title), m_Mode(mode) {
+    glfwSetErrorCallback(GLFWErrorCallback);  // Catch errors raised during initialization
+
+    // Without a display, use GLFW's null platform (needs GLFW >= 3.4)
+    if (m_Mode == WindowMode::Headless) {
+#ifdef GLFW_PLATFORM_NULL
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#else
+        ARC_CORE_WARN("GLFW was built without the null platform, headless mode needs a display");
+#endif
+    }
+
     // Initialize GLFW
     int glfwInitialized = glfwInit();
     ARC_CORE_ASSERT(glfwInitialized, "Failed to initialize GLFW!");
 
+    if (m_Mode != WindowMode::Windowed) {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    }
+    if (m_Mode == WindowMode::Headless) {
+        // EGL on the null platform gives a surfaceless context (e.g. Mesa llvmpipe)
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+    }
+
     // Create the window
     m_Window = glfwCreateWindow(m_UserStruct.Width, m_UserStruct.Height, m_UserStruct.Title,
                                 nullptr, nullptr);
+    ARC_CORE_ASSERT(m_Window, "Failed to create window!");
 
     // Disable vsync
     // glfwSwapInterval(0);
@@ -126,8 +146,13 @@ Window::~Window() {
 }
 
 void Window::Update() {
+    ARC_PROFILE_FUNCTION();
     glfwPollEvents();
-    m_Context->SwapBuffers();
+
+    // A surfaceless context has no back buffer to present
+    if (m_Mode != WindowMode::Headless) {
+        m_Context->SwapBuffers();
+    }
 }
 
 }  // namespace ARcane
@@ -0,0 +1,367 @@
+#include "ARcane/Debug/Instrumentor.hpp"
+#include "ARcane/Core/Log.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+
+namespace ARcane {
+
+// How often the writer thread drains the thread buffers during a session. At this rate a thread
+// has to record over 600k scopes per second before its ring overflows.
+static constexpr std::chrono::milliseconds DrainInterval{100};
+// Formatted JSON is written in blocks of about this size
+static constexpr size_t BlockSize = 1 << 20;
+
+thread_local ProfileThreadBuffer* Instrumentor::s_ThreadBuffer = nullptr;
+
+struct Instrumentor::ThreadOwner {
+    std::shared_ptr<ProfileThreadBuffer> Buffer;
+
+    ~ThreadOwner() {
+        if (Buffer) Buffer->Finished = true;
+        s_ThreadBuffer = nullptr;
+    }
+};
+
+// Appends one complete ("X") event, with times relative to originNs
+static void AppendEvent(std::string& block, uint64_t& count, uint64_t originNs, uint32_t threadID,
+                        const ProfileThreadBuffer::Record& record) {
+    if (count++ > 0) block += ',';
+
+    // Chrome trace times are in microseconds; three decimals keep the nanoseconds
+    char buffer[96];
+    snprintf(buffer, sizeof(buffer), "{\"cat\":\"function\",\"dur\":%.3f,\"name\":\"",
+             (record.EndNs - record.StartNs) / 1000.0);
+    block += buffer;
+    for (const char* c = record.Name; *c; c++) {
+        if (*c == '"' || *c == '\\') block += '\\';
+        block += *c;
+    }
+    snprintf(buffer, sizeof(buffer), "\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f}", threadID,
+             (int64_t)(record.StartNs - originNs) / 1000.0);
+    block += buffer;
+}
+
+uint64_t ProfileThreadBuffer::Read(uint64_t& cursor, std::vector<Record>& records) const {
+    const uint64_t head = GetHead();
+    uint64_t lost = 0;
+    if (head - cursor > Capacity) {
+        lost = head - cursor - Capacity;
+        cursor = head - Capacity;
+    }
+
+    const size_t first = records.size();
+    for (uint64_t i = cursor; i < head; i++) {
+        const Event& event = m_Events[i & (Capacity - 1)];
+        records.push_back({event.Name.load(std::memory_order_relaxed),
+                           event.StartNs.load(std::memory_order_relaxed),
+                           event.EndNs.load(std::memory_order_relaxed)});
+    }
+
+    // The thread kept pushing while the events were copied: drop the ones it may have
+    // overwritten, including the slot it may be writing right now. Pairs with the release fence
+    // in Push(): a slot store seen above implies the head that preceded it is seen here.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t current = m_Head.load(std::memory_order_relaxed);
+    const uint64_t firstValid = current + 1 > Capacity ? current + 1 - Capacity : 0;
+    if (firstValid > cursor) {
+        uint64_t overwritten = std::min(firstValid - cursor, head - cursor);
+        records.erase(records.begin() + first, records.begin() + first + overwritten);
+        lost += overwritten;
+    }
+
+    cursor = head;
+    return lost;
+}
+
+uint64_t ProfileThreadBuffer::GetLastEndNs() const {
+    const uint64_t head = GetHead();
+    return head ? m_Events[(head - 1) & (Capacity - 1)].EndNs.load(std::memory_order_relaxed) : 0;
+}
+
+Instrumentor::~Instrumentor() {
+    EndSession();
+    StopFlightRecorder();
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_StopWriter = true;
+    }
+    m_Condition.notify_one();
+    if (m_WriterThread.joinable()) {
+        m_WriterThread.join();
+    }
+}
+
+void Instrumentor::BeginSession(const std::string& name, const std::string& filepath) {
+    EndSession();
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_OutputStream.open(filepath);
+    if (!m_OutputStream.is_open()) {
+        ARC_CORE_ERROR("Failed to open profile file '{0}'", filepath);
+        return;
+    }
+
+    // Events left over from before the session (or recorded for the flight recorder) are not
+    // part of it
+    AdoptNewThreads();
+    for (ThreadEntry& entry : m_Threads) {
+        entry.Cursor = entry.Buffer->GetHead();
+    }
+
+    m_SessionStartNs = Now();
+    m_EventCount = 0;
+    m_LostCount = 0;
+    m_Block = "{\"otherData\":{\"session\":\"" + name + "\"},\"traceEvents\":[";
+
+    m_SessionActive = true;
+    UpdateRecording();
+    StartWriter();
+    m_Condition.notify_one();
+}
+
+void Instrumentor::EndSession() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_SessionActive) return;
+    m_SessionActive = false;
+    UpdateRecording();
+
+    Drain();
+    m_OutputStream << "]}";
+    m_OutputStream.close();
+
+    if (m_LostCount > 0) {
+        ARC_CORE_WARN("Profiler lost {0} events, the writer thread fell behind",
+                      m_LostCount.load());
+    }
+}
+
+void Instrumentor::StartFlightRecorder(const FlightRecorderSettings& settings) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_FlightSettings = settings;
+    m_FlightRecorderActive = true;
+    UpdateRecording();
+    StartWriter();
+    m_Condition.notify_one();
+}
+
+void Instrumentor::StopFlightRecorder() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_FlightRecorderActive = false;
+    UpdateRecording();
+    m_DumpTriggerNs = 0;
+}
+
+void Instrumentor::BeginLiveCapture() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_LiveCaptureCount++;
+    UpdateRecording();
+    // The writer releases the buffers of exited threads
+    StartWriter();
+    m_Condition.notify_one();
+}
+
+void Instrumentor::EndLiveCapture() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_LiveCaptureCount > 0) {
+        m_LiveCaptureCount--;
+    }
+    UpdateRecording();
+}
+
+bool Instrumentor::GetThreadBuffers(std::vector<std::shared_ptr<ProfileThreadBuffer>>& buffers,
+                                    uint64_t& version) {
+    std::lock_guard<std::mutex> lock(m_ThreadsMutex);
+    if (version == m_BuffersVersion) return false;
+    buffers = m_Buffers;
+    version = m_BuffersVersion;
+    return true;
+}
+
+void Instrumentor::UpdateRecording() {
+    m_Recording = m_SessionActive || m_FlightRecorderActive || m_LiveCaptureCount > 0;
+}
+
+void Instrumentor::MarkFrame() {
+    const uint64_t now = Now();
+    const uint64_t frameStartNs = m_LastFrameNs;
+    m_LastFrameNs = now;
+    if (!frameStartNs || !m_Recording.load(std::memory_order_relaxed)) return;
+
+    Record(FrameScopeName, frameStartNs, now);
+    if (!m_FlightRecorderActive.load(std::memory_order_relaxed)) return;
+
+    // m_FlightSettings is only written by this thread, in StartFlightRecorder()
+    const uint64_t frameNs = now - frameStartNs;
+    if (frameNs <= (uint64_t)(m_FlightSettings.FrameBudgetMs * 1e6)) return;
+    if (m_LastDumpNs &&
+        now - m_LastDumpNs < (uint64_t)(m_FlightSettings.MinDumpIntervalSeconds * 1e9)) {
+        return;
+    }
+    if (m_DumpCount >= m_FlightSettings.MaxDumps) return;
+
+    m_LastDumpNs = now;
+    m_DumpCount++;
+    m_DumpFrameNs = frameNs;
+    m_DumpTriggerNs = now;
+    m_Condition.notify_one();
+}
+
+ProfileThreadBuffer* Instrumentor::RegisterThread() {
+    // Destroyed when the thread exits; the writer still reads what it recorded
+    static thread_local ThreadOwner owner;
+
+    std::lock_guard<std::mutex> lock(m_ThreadsMutex);
+    owner.Buffer = std::make_shared<ProfileThreadBuffer>(m_NextThreadID++);
+    m_NewThreads.push_back(owner.Buffer);
+    m_Buffers.push_back(owner.Buffer);
+    m_BuffersVersion++;
+    s_ThreadBuffer = owner.Buffer.get();
+    return s_ThreadBuffer;
+}
+
+void Instrumentor::StartWriter() {
+    if (!m_WriterThread.joinable()) {
+        m_WriterThread = std::thread(&Instrumentor::WriterLoop, this);
+    }
+}
+
+void Instrumentor::AdoptNewThreads() {
+    std::lock_guard<std::mutex> lock(m_ThreadsMutex);
+    for (auto& buffer : m_NewThreads) {
+        m_Threads.push_back({std::move(buffer), 0});
+    }
+    m_NewThreads.clear();
+}
+
+void Instrumentor::WriterLoop() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (!m_StopWriter) {
+        if (m_Recording) {
+            // MarkFrame() notifies without the lock: the timeout also bounds a missed wakeup
+            m_Condition.wait_for(lock, DrainInterval,
+                                 [this] { return m_StopWriter || m_DumpTriggerNs != 0; });
+        } else {
+            m_Condition.wait(lock, [this] { return m_StopWriter || m_Recording; });
+        }
+
+        if (m_SessionActive) {
+            Drain();
+        }
+        uint64_t triggerNs = m_DumpTriggerNs.exchange(0);
+        if (triggerNs && m_FlightRecorderActive) {
+            WriteFlightDump(triggerNs, m_DumpFrameNs);
+        }
+        PruneThreads();
+    }
+}
+
+void Instrumentor::Drain() {
+    AdoptNewThreads();
+
+    for (ThreadEntry& entry : m_Threads) {
+        m_Records.clear();
+        m_LostCount += entry.Buffer->Read(entry.Cursor, m_Records);
+        for (const auto& record : m_Records) {
+            AppendEvent(m_Block, m_EventCount, m_SessionStartNs, entry.Buffer->GetThreadID(),
+                        record);
+            if (m_Block.size() >= BlockSize) {
+                m_OutputStream.write(m_Block.data(), m_Block.size());
+                m_Block.clear();
+            }
+        }
+    }
+
+    if (!m_Block.empty()) {
+        m_OutputStream.write(m_Block.data(), m_Block.size());
+        m_Block.clear();
+    }
+    m_OutputStream.flush();
+}
+
+void Instrumentor::WriteFlightDump(uint64_t triggerNs, uint64_t frameNs) {
+    AdoptNewThreads();
+
+    const uint64_t durationNs = (uint64_t)(m_FlightSettings.DurationSeconds * 1e9);
+    const uint64_t windowStartNs = triggerNs > durationNs ? triggerNs - durationNs : 0;
+
+    char stamp[32];
+    std::time_t wallTime = std::time(nullptr);
+    std::tm local;
+    localtime_r(&wallTime, &local);
+    strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", &local);
+    const std::string path = m_FlightSettings.Directory + "/ARcaneFlight-" + stamp + "-" +
+                             std::to_string(m_DumpCount.load()) + ".json";
+
+    std::ofstream output(path);
+    if (!output.is_open()) {
+        ARC_CORE_ERROR("Failed to open flight recorder file '{0}'", path);
+        return;
+    }
+
+    char buffer[160];
+    snprintf(buffer, sizeof(buffer),
+             "{\"otherData\":{\"frame_ms\":%.2f,\"budget_ms\":%.2f},\"traceEvents\":[",
+             frameNs / 1e6, m_FlightSettings.FrameBudgetMs);
+    std::string block = buffer;
+    uint64_t count = 0;
+
+    // The whole ring of every thread, with cursors of their own so a session is not disturbed
+    for (ThreadEntry& entry : m_Threads) {
+        const uint64_t head = entry.Buffer->GetHead();
+        uint64_t cursor = head > ProfileThreadBuffer::Capacity
+                              ? head - ProfileThreadBuffer::Capacity
+                              : 0;
+        m_Records.clear();
+        entry.Buffer->Read(cursor, m_Records);
+        for (const auto& record : m_Records) {
+            if (record.EndNs >= windowStartNs) {
+                AppendEvent(block, count, windowStartNs, entry.Buffer->GetThreadID(), record);
+            }
+        }
+    }
+
+    // Marks the end of the slow frame on every track
+    snprintf(buffer, sizeof(buffer),
+             "%s{\"name\":\"Frame budget exceeded\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":0,"
+             "\"ts\":%.3f}]}",
+             count > 0 ? "," : "", (triggerNs - windowStartNs) / 1000.0);
+    block += buffer;
+    output.write(block.data(), block.size());
+
+    ARC_CORE_WARN("Frame took {0:.1f} ms, flight recorder wrote the last {1} s to '{2}'",
+                  frameNs / 1e6, m_FlightSettings.DurationSeconds, path);
+}
+
+void Instrumentor::PruneThreads() {
+    // Threads that only ever recorded for the flight recorder or live readers are adopted here,
+    // since nothing else would once they exit
+    AdoptNewThreads();
+
+    // The buffer of an exited thread goes once the session has read it and it is older than
+    // anything a dump would include
+    const uint64_t now = Now();
+    const uint64_t keepNs =
+        m_FlightRecorderActive ? (uint64_t)(m_FlightSettings.DurationSeconds * 1e9) : 0;
+    auto released = std::remove_if(m_Threads.begin(), m_Threads.end(),
+                                   [&](const ThreadEntry& entry) {
+                                       const ProfileThreadBuffer& buffer = *entry.Buffer;
+                                       return buffer.Finished &&
+                                              (!m_SessionActive ||
+                                               entry.Cursor == buffer.GetHead()) &&
+                                              buffer.GetLastEndNs() + keepNs < now;
+                                   });
+    if (released == m_Threads.end()) return;
+
+    // Live readers hold references of their own to the buffers they still read
+    std::lock_guard<std::mutex> lock(m_ThreadsMutex);
+    for (auto entry = released; entry != m_Threads.end(); ++entry) {
+        m_Buffers.erase(std::find(m_Buffers.begin(), m_Buffers.end(), entry->Buffer));
+    }
+    m_BuffersVersion++;
+    m_Threads.erase(released, m_Threads.end());
+}
+
+}  // namespace ARcane
@@ -0,0 +1,335 @@
+#include "ARcane/Debug/ProfilerPanel.hpp"
+
+#include "imgui.h"
+
+#include <algorithm>
+
+namespace ARcane {
+
+static constexpr float FrameGraphHeight = 80.0f;
+static constexpr float LaneHeight = 18.0f;
+
+// Stable color per scope name, so a scope keeps its color across frames
+static ImU32 GetScopeColor(const char* name) {
+    uint32_t hash = 2166136261u;
+    for (const char* c = name; *c; c++) {
+        hash = (hash ^ (uint8_t)*c) * 16777619u;
+    }
+    return IM_COL32(80 + hash % 140, 80 + (hash >> 8) % 140, 80 + (hash >> 16) % 140, 255);
+}
+
+ProfilerPanel::ProfilerPanel() : Layer("ProfilerPanel") {}
+
+void ProfilerPanel::OnAttach() {
+    Instrumentor::Get().BeginLiveCapture();
+    m_WindowStartNs = Instrumentor::Now();
+}
+
+void ProfilerPanel::OnDetach() {
+    Instrumentor::Get().EndLiveCapture();
+    m_Tracks.clear();
+    m_Buffers.clear();
+    m_BuffersVersion = 0;
+}
+
+void ProfilerPanel::Collect() {
+    // Threads come and go rarely, so the tracks are only matched against the Instrumentor's list
+    // when it changed. New threads are read from their current position, older events belong to
+    // no window.
+    if (Instrumentor::Get().GetThreadBuffers(m_Buffers, m_BuffersVersion)) {
+        std::unordered_set<const ProfileThreadBuffer*> untracked;
+        for (const auto& buffer : m_Buffers) {
+            untracked.insert(buffer.get());
+        }
+        for (Track& track : m_Tracks) {
+            track.Registered = untracked.erase(track.Buffer.get()) > 0;
+        }
+        for (const auto& buffer : m_Buffers) {
+            if (untracked.count(buffer.get())) {
+                m_Tracks.push_back({buffer, buffer->GetHead(), {}, true});
+            }
+        }
+    }
+
+    for (Track& track : m_Tracks) {
+        m_Records.clear();
+        // An exited thread that was read to the end has nothing new
+        if (!track.Buffer->Finished || track.Cursor != track.Buffer->GetHead()) {
+            track.Buffer->Read(track.Cursor, m_Records);
+        }
+        for (const auto& record : m_Records) {
+            if (record.Name == Instrumentor::FrameScopeName) {
+                m_WindowFrameCount++;
+                if (!m_Paused) {
+                    m_Frames.push_back({record.StartNs, record.EndNs});
+                    if (m_Frames.size() > HistorySize) m_Frames.pop_front();
+                }
+                continue;
+            }
+
+            ScopeStats& stats = m_Stats[record.Name];
+            const uint64_t durationNs = record.EndNs - record.StartNs;
+            stats.Calls++;
+            stats.MinNs = std::min(stats.MinNs, durationNs);
+            stats.Durations.Record(durationNs);
+
+            if (!m_Paused) {
+                track.Spans.push_back({record.Name, record.StartNs, record.EndNs});
+            }
+        }
+
+        // Spans are kept as long as the frame graph can select their frame, and bounded in
+        // case frames are not marked at all
+        if (!m_Paused && !m_Frames.empty()) {
+            while (!track.Spans.empty() && track.Spans.front().EndNs < m_Frames.front().StartNs) {
+                track.Spans.pop_front();
+            }
+        }
+        while (track.Spans.size() > ProfileThreadBuffer::Capacity) {
+            track.Spans.pop_front();
+        }
+    }
+
+    // Exited threads go once the Instrumentor released them and there is nothing left of them to
+    // show. Until then they stay, so they are not tracked again from scratch.
+    m_Tracks.erase(std::remove_if(m_Tracks.begin(), m_Tracks.end(),
+                                  [](const Track& track) {
+                                      return !track.Registered && track.Spans.empty() &&
+                                             track.Cursor == track.Buffer->GetHead();
+                                  }),
+                   m_Tracks.end());
+}
+
+void ProfilerPanel::PublishStats(uint64_t nowNs) {
+    if (nowNs - m_WindowStartNs < StatsWindowNs) return;
+
+    const double frames = (double)std::max<uint64_t>(m_WindowFrameCount, 1);
+    m_Summary.clear();
+    for (auto& [name, stats] : m_Stats) {
+        if (stats.Calls == 0) continue;
+        m_Summary.push_back({name, stats.Calls / frames, stats.MinNs / 1e6f,
+                             (float)(stats.Durations.GetMean() / 1e6),
+                             stats.Durations.GetPercentile(99.0) / 1e6f,
+                             stats.Durations.GetMax() / 1e6f});
+
+        // Entries stay in the map, so steady state aggregation never allocates
+        stats.Calls = 0;
+        stats.MinNs = UINT64_MAX;
+        stats.Durations.Reset();
+    }
+    // Most time per frame first
+    std::sort(m_Summary.begin(), m_Summary.end(), [](const auto& a, const auto& b) {
+        return a.AvgMs * a.CallsPerFrame > b.AvgMs * b.CallsPerFrame;
+    });
+
+    m_WindowStartNs = nowNs;
+    m_WindowFrameCount = 0;
+}
+
+void ProfilerPanel::OnImGuiRender() {
+    Collect();
+    PublishStats(Instrumentor::Now());
+
+    ImGui::Begin("Profiler");
+
+    if (ImGui::Checkbox("Pause", &m_Paused) && !m_Paused) {
+        m_SelectedFrameEndNs = 0;
+    }
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::SliderFloat("Budget", &m_BudgetMs, 4.0f, 50.0f, "%.1f ms");
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::SliderInt("Frames", &m_TimelineFrames, 1, (int)MaxTimelineFrames);
+
+    DrawFrameGraph();
+    ImGui::Separator();
+    DrawTimeline();
+    ImGui::Separator();
+    DrawScopeTable();
+
+    ImGui::End();
+}
+
+void ProfilerPanel::DrawFrameGraph() {
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const float width = std::max(ImGui::GetContentRegionAvail().x, 100.0f);
+    ImGui::InvisibleButton("##FrameGraph", ImVec2(width, FrameGraphHeight));
+    const bool hovered = ImGui::IsItemHovered();
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+    float maxMs = m_BudgetMs * 2.0f;
+    for (const Frame& frame : m_Frames) {
+        maxMs = std::max(maxMs, (frame.EndNs - frame.StartNs) / 1e6f);
+    }
+    const float bottom = origin.y + FrameGraphHeight;
+    const float scale = FrameGraphHeight / maxMs;
+    const float barWidth = width / HistorySize;
+
+    // Newest frame on the right
+    const float first = origin.x + width - barWidth * m_Frames.size();
+    for (size_t i = 0; i < m_Frames.size(); i++) {
+        const Frame& frame = m_Frames[i];
+        const float ms = (frame.EndNs - frame.StartNs) / 1e6f;
+        const float x = first + barWidth * i;
+
+        ImU32 color = ms <= m_BudgetMs          ? IM_COL32(90, 180, 90, 255)
+                      : ms <= m_BudgetMs * 2.0f ? IM_COL32(220, 170, 60, 255)
+                                                : IM_COL32(220, 70, 70, 255);
+        if (frame.EndNs == m_SelectedFrameEndNs) {
+            color = IM_COL32(120, 160, 255, 255);
+        }
+        drawList->AddRectFilled(ImVec2(x, bottom - ms * scale),
+                                ImVec2(x + std::max(barWidth - 1.0f, 1.0f), bottom), color);
+
+        const ImVec2 mouse = ImGui::GetMousePos();
+        if (hovered && mouse.x >= x && mouse.x < x + barWidth) {
+            ImGui::SetTooltip("%.2f ms", ms);
+            if (ImGui::IsMouseClicked(0)) {
+                m_Paused = true;
+                m_SelectedFrameEndNs = frame.EndNs;
+            }
+        }
+    }
+
+    // Budget, and twice the budget (a missed refresh at the budget's frame rate)
+    for (float budget : {m_BudgetMs, m_BudgetMs * 2.0f}) {
+        const float y = bottom - budget * scale;
+        drawList->AddLine(ImVec2(origin.x, y), ImVec2(origin.x + width, y),
+                          IM_COL32(255, 255, 255, 120));
+        char label[32];
+        snprintf(label, sizeof(label), "%.1f ms", budget);
+        drawList->AddText(ImVec2(origin.x + 2.0f, y - ImGui::GetTextLineHeight()),
+                          IM_COL32(255, 255, 255, 160), label);
+    }
+}
+
+void ProfilerPanel::DrawTimeline() {
+    if (m_Frames.empty()) {
+        ImGui::Text("No frames recorded, is ARC_PROFILE_FRAME() called?");
+        return;
+    }
+
+    // The selected frame (or the latest) and the ones before it
+    size_t last = m_Frames.size() - 1;
+    if (m_SelectedFrameEndNs) {
+        for (size_t i = 0; i < m_Frames.size(); i++) {
+            if (m_Frames[i].EndNs == m_SelectedFrameEndNs) last = i;
+        }
+    }
+    const size_t firstFrame =
+        last + 1 >= (size_t)m_TimelineFrames ? last + 1 - m_TimelineFrames : 0;
+    const uint64_t rangeStartNs = m_Frames[firstFrame].StartNs;
+    const uint64_t rangeEndNs = m_Frames[last].EndNs;
+    ImGui::Text("%.2f ms over %zu frame(s)", (rangeEndNs - rangeStartNs) / 1e6,
+                last - firstFrame + 1);
+
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const float width = std::max(ImGui::GetContentRegionAvail().x, 100.0f);
+    const float scale = width / (float)std::max<uint64_t>(rangeEndNs - rangeStartNs, 1);
+    const ImVec2 mouse = ImGui::GetMousePos();
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+    // Nested scopes end before their parent, so sorting by start (longest first on ties) and
+    // keeping a stack of end times gives each span its depth
+    std::vector<std::pair<const Span*, uint32_t>> visible;
+    std::vector<uint64_t> stack;
+    const Span* hoveredSpan = nullptr;
+    float y = origin.y;
+    for (const Track& track : m_Tracks) {
+        visible.clear();
+        for (const Span& span : track.Spans) {
+            if (span.EndNs >= rangeStartNs && span.StartNs <= rangeEndNs) {
+                visible.push_back({&span, 0});
+            }
+        }
+        if (visible.empty()) continue;
+        std::sort(visible.begin(), visible.end(), [](const auto& a, const auto& b) {
+            return a.first->StartNs != b.first->StartNs ? a.first->StartNs < b.first->StartNs
+                                                        : a.first->EndNs > b.first->EndNs;
+        });
+
+        stack.clear();
+        uint32_t depthCount = 1;
+        for (auto& [span, depth] : visible) {
+            while (!stack.empty() && stack.back() <= span->StartNs) stack.pop_back();
+            depth = (uint32_t)stack.size();
+            stack.push_back(span->EndNs);
+            depthCount = std::max(depthCount, depth + 1);
+        }
+
+        char label[32];
+        snprintf(label, sizeof(label), "Thread %u", track.Buffer->GetThreadID());
+        drawList->AddText(ImVec2(origin.x, y), IM_COL32(200, 200, 200, 255), label);
+        y += ImGui::GetTextLineHeightWithSpacing();
+
+        for (const auto& [span, depth] : visible) {
+            float x0 = origin.x + (float)((int64_t)(span->StartNs - rangeStartNs)) * scale;
+            float x1 = origin.x + (float)((int64_t)(span->EndNs - rangeStartNs)) * scale;
+            x0 = std::max(x0, origin.x);
+            x1 = std::max(std::min(x1, origin.x + width), x0 + 1.0f);
+            const float top = y + depth * LaneHeight;
+
+            drawList->AddRectFilled(ImVec2(x0, top), ImVec2(x1, top + LaneHeight - 1.0f),
+                                    GetScopeColor(span->Name));
+            if (x1 - x0 > ImGui::CalcTextSize(span->Name).x + 4.0f) {
+                drawList->AddText(ImVec2(x0 + 2.0f, top + 1.0f), IM_COL32(0, 0, 0, 255),
+                                  span->Name);
+            }
+            if (mouse.x >= x0 && mouse.x < x1 && mouse.y >= top && mouse.y < top + LaneHeight) {
+                hoveredSpan = span;
+            }
+        }
+        y += depthCount * LaneHeight + 4.0f;
+    }
+
+    // Frame boundaries across every lane
+    for (size_t i = firstFrame; i <= last; i++) {
+        const float x = origin.x + (float)(m_Frames[i].StartNs - rangeStartNs) * scale;
+        drawList->AddLine(ImVec2(x, origin.y), ImVec2(x, y), IM_COL32(255, 255, 255, 80));
+    }
+
+    ImGui::InvisibleButton("##Timeline", ImVec2(width, std::max(y - origin.y, 1.0f)));
+    if (hoveredSpan && ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("%s\n%.3f ms", hoveredSpan->Name,
+                          (hoveredSpan->EndNs - hoveredSpan->StartNs) / 1e6);
+    }
+}
+
+void ProfilerPanel::DrawScopeTable() {
+    ImGui::Text("Last %.0f s", StatsWindowNs / 1e9);
+    const ImGuiTableFlags flags =
+        ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+    if (!ImGui::BeginTable("Scopes", 6, flags)) return;
+
+    ImGui::TableSetupColumn("Scope");
+    ImGui::TableSetupColumn("Calls/frame");
+    ImGui::TableSetupColumn("Min ms");
+    ImGui::TableSetupColumn("Avg ms");
+    ImGui::TableSetupColumn("P99 ms");
+    ImGui::TableSetupColumn("Max ms");
+    ImGui::TableHeadersRow();
+
+    for (const ScopeSummary& scope : m_Summary) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(scope.Name);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.2f", scope.CallsPerFrame);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", scope.MinMs);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", scope.AvgMs);
+        ImGui::TableNextColumn();
+        if (scope.P99Ms > m_BudgetMs) {
+            ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%.3f", scope.P99Ms);
+        } else {
+            ImGui::Text("%.3f", scope.P99Ms);
+        }
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", scope.MaxMs);
+    }
+    ImGui::EndTable();
+}
+
+}  // namespace ARcane
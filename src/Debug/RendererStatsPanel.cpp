@@ -0,0 +1,73 @@
+#include "ARcane/Debug/RendererStatsPanel.hpp"
+
+#include "ARcane/Core/Application.hpp"
+#include "ARcane/Renderer/Renderer2D.hpp"
+#include "imgui.h"
+
+#include <algorithm>
+
+namespace ARcane {
+
+static void PlotHistory(const char* label, const float* values, uint32_t count, uint32_t offset,
+                        float current, float max, const char* format) {
+    char overlay[64];
+    snprintf(overlay, sizeof(overlay), format, current);
+    ImGui::PlotLines(label, values, (int)count, (int)offset, overlay, 0.0f, max * 1.2f + 0.001f,
+                     ImVec2(0.0f, 50.0f));
+}
+
+void RendererStatsPanel::History::Push(float value, uint32_t offset) {
+    Values[offset] = value;
+    Max = *std::max_element(Values.begin(), Values.end());
+}
+
+RendererStatsPanel::RendererStatsPanel() : Layer("RendererStatsPanel") {}
+
+void RendererStatsPanel::OnUpdate(Timestep ts) { m_FrameTimeMs = ts.GetMilliseconds(); }
+
+void RendererStatsPanel::OnImGuiRender() {
+    // Layers are drawn before ImGui, so this frame's renderer stats are complete at this point
+    Renderer2D::Statistics stats = Renderer2D::GetStats();
+    float imguiGPUTimeMs = Application::Get().GetImGuiLayer()->GetGPUTimeMs();
+
+    m_FrameTime.Push(m_FrameTimeMs, m_Offset);
+    m_SceneGPUTime.Push(stats.GPUTimeMs, m_Offset);
+    m_ImGuiGPUTime.Push(imguiGPUTimeMs, m_Offset);
+    m_VertexKB.Push(stats.VertexBytesUploaded / 1024.0f, m_Offset);
+    m_TextureKB.Push(stats.TextureBytesUploaded / 1024.0f, m_Offset);
+    m_DrawCalls.Push((float)stats.DrawCalls, m_Offset);
+    m_Offset = (m_Offset + 1) % HistorySize;
+
+    ImGui::Begin("Renderer Stats");
+
+    ImGui::Text("Timing");
+    PlotHistory("CPU frame", m_FrameTime.Values.data(), HistorySize, m_Offset, m_FrameTimeMs,
+                m_FrameTime.Max, "%.2f ms");
+    PlotHistory("GPU scene", m_SceneGPUTime.Values.data(), HistorySize, m_Offset, stats.GPUTimeMs,
+                m_SceneGPUTime.Max, "%.2f ms");
+    PlotHistory("GPU ImGui", m_ImGuiGPUTime.Values.data(), HistorySize, m_Offset, imguiGPUTimeMs,
+                m_ImGuiGPUTime.Max, "%.2f ms");
+
+    ImGui::Separator();
+    ImGui::Text("Uploads");
+    PlotHistory("Vertices", m_VertexKB.Values.data(), HistorySize, m_Offset,
+                stats.VertexBytesUploaded / 1024.0f, m_VertexKB.Max, "%.1f KB");
+    PlotHistory("Textures", m_TextureKB.Values.data(), HistorySize, m_Offset,
+                stats.TextureBytesUploaded / 1024.0f, m_TextureKB.Max, "%.1f KB");
+
+    ImGui::Separator();
+    ImGui::Text("Batching");
+    PlotHistory("Draw calls", m_DrawCalls.Values.data(), HistorySize, m_Offset,
+                (float)stats.DrawCalls, m_DrawCalls.Max, "%.0f");
+    ImGui::Text("Quads: %u (culled: %u)", stats.QuadCount, stats.CulledQuadCount);
+    ImGui::Text("Vertices: %u, Indices: %u", stats.GetTotalVertexCount(),
+                stats.GetTotalIndexCount());
+    ImGui::Text("Texture binds: %u", stats.TextureBinds);
+    ImGui::Text("Flushes: buffer full %u, texture slots full %u, end of scene %u, camera %u",
+                stats.FlushesBufferFull, stats.FlushesTextureSlotsFull, stats.FlushesEndOfScene,
+                stats.FlushesCameraQuad);
+
+    ImGui::End();
+}
+
+}  // namespace ARcane
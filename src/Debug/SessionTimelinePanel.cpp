@@ -0,0 +1,67 @@
+#include "ARcane/Debug/SessionTimelinePanel.hpp"
+
+#include "imgui.h"
+
+namespace ARcane {
+
+static void FormatTime(char* buffer, size_t size, double seconds) {
+    uint64_t ms = (uint64_t)(seconds * 1000.0);
+    snprintf(buffer, size, "%02u:%02u:%02u.%03u", (unsigned)(ms / 3600000),
+             (unsigned)(ms / 60000 % 60), (unsigned)(ms / 1000 % 60), (unsigned)(ms % 1000));
+}
+
+SessionTimelinePanel::SessionTimelinePanel(const Ref<SessionPlayer>& player)
+    : Layer("SessionTimelinePanel"), m_Player(player) {}
+
+void SessionTimelinePanel::OnUpdate(Timestep ts) { m_Player->OnUpdate(ts); }
+
+void SessionTimelinePanel::OnImGuiRender() {
+    ImGui::Begin("Session Timeline");
+
+    const SessionReader& reader = m_Player->GetReader();
+    if (!m_Player->IsOpen()) {
+        ImGui::Text("No recording loaded from '%s'", reader.GetPath().c_str());
+        ImGui::End();
+        return;
+    }
+
+    if (ImGui::Button(m_Player->IsPlaying() ? "Pause" : "Play")) {
+        m_Player->SetPlaying(!m_Player->IsPlaying());
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("<")) m_Player->Step(-1);
+    ImGui::SameLine();
+    if (ImGui::Button(">")) m_Player->Step(1);
+    ImGui::SameLine();
+    float speed = m_Player->GetSpeed();
+    ImGui::SetNextItemWidth(120.0f);
+    if (ImGui::SliderFloat("Speed", &speed, 0.25f, 8.0f, "%.2fx")) {
+        m_Player->SetSpeed(speed);
+    }
+
+    // Seconds since the start; a float keeps millisecond precision over several hours
+    const double duration = (reader.GetEndNs() - reader.GetStartNs()) / 1e9;
+    float position = (float)((m_Player->GetPositionNs() - reader.GetStartNs()) / 1e9);
+
+    char current[32], total[32], overlay[80];
+    FormatTime(current, sizeof(current), position);
+    FormatTime(total, sizeof(total), duration);
+    snprintf(overlay, sizeof(overlay), "%s / %s", current, total);
+
+    ImGui::SetNextItemWidth(-1.0f);
+    if (ImGui::SliderFloat("##Timeline", &position, 0.0f, (float)duration, overlay)) {
+        m_Player->Seek(reader.GetStartNs() + (uint64_t)(position * 1e9));
+    }
+
+    ImGui::Text("Frame %zu / %zu", m_Player->GetCurrentRecord() + 1, reader.GetRecordCount());
+    ImGui::SameLine();
+    ImGui::Text("| cached %zu, decoded %llu", m_Player->GetCachedCount(),
+                (unsigned long long)m_Player->GetDecodedCount());
+    if (!reader.HasIndex()) {
+        ImGui::Text("No index in the file, rebuilt by scanning");
+    }
+
+    ImGui::End();
+}
+
+}  // namespace ARcane
@@ -0,0 +1,119 @@
+#include "ARcane/Debug/StreamStatsPanel.hpp"
+
+#include "imgui.h"
+
+#include <algorithm>
+
+namespace ARcane {
+
+// A stream that received nothing for this long is shown as stalled
+static constexpr double StallThresholdMs = 1000.0;
+
+StreamStatsPanel::StreamStatsPanel() : Layer("StreamStatsPanel") {}
+
+void StreamStatsPanel::AddStream(const std::string& name, const CameraStream& stream) {
+    m_Streams.push_back({name, &stream});
+}
+
+void StreamStatsPanel::RemoveStream(const CameraStream& stream) {
+    m_Streams.erase(std::remove_if(m_Streams.begin(), m_Streams.end(),
+                                   [&](const Entry& entry) { return entry.Stream == &stream; }),
+                    m_Streams.end());
+}
+
+static void FormatAge(char* buffer, size_t size, double ageMs) {
+    if (ageMs < 0.0) {
+        snprintf(buffer, size, "-");
+    } else if (ageMs < StallThresholdMs) {
+        snprintf(buffer, size, "%.0f ms", ageMs);
+    } else {
+        snprintf(buffer, size, "%.1f s", ageMs / 1000.0);
+    }
+}
+
+void StreamStatsPanel::OnImGuiRender() {
+    ImGui::Begin("Stream Stats");
+
+    if (m_Streams.empty()) {
+        ImGui::Text("No streams");
+        ImGui::End();
+        return;
+    }
+
+    const uint64_t now = GetSteadyClockNs();
+    const ImGuiTableFlags flags =
+        ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+    if (ImGui::BeginTable("Streams", 9, flags)) {
+        ImGui::TableSetupColumn("Stream");
+        ImGui::TableSetupColumn("Recv fps");
+        ImGui::TableSetupColumn("Decode fps");
+        ImGui::TableSetupColumn("Mbit/s");
+        ImGui::TableSetupColumn("Decode p50/p99/max");
+        ImGui::TableSetupColumn("Last frame");
+        ImGui::TableSetupColumn("Received");
+        ImGui::TableSetupColumn("Dropped");
+        ImGui::TableSetupColumn("Errors");
+        ImGui::TableHeadersRow();
+
+        for (const Entry& entry : m_Streams) {
+            StreamStats::Snapshot stats = entry.Stream->GetStats().GetSnapshot(now);
+            uint64_t dropped = 0;
+            for (uint64_t count : stats.DroppedCount) {
+                dropped += count;
+            }
+            char age[32];
+            FormatAge(age, sizeof(age), stats.LastReceiveAgeMs);
+            const bool stalled = stats.LastReceiveAgeMs >= StallThresholdMs;
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(entry.Name.c_str());
+            bool hovered = ImGui::IsItemHovered();
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", stats.ReceiveFps);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", stats.DecodeFps);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", stats.Bitrate / 1e6);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f / %.1f / %.1f ms", stats.DecodeTimeP50Us / 1000.0,
+                        stats.DecodeTimeP99Us / 1000.0, stats.DecodeTimeMaxUs / 1000.0);
+            ImGui::TableNextColumn();
+            if (stalled) {
+                ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%s", age);
+            } else {
+                ImGui::TextUnformatted(age);
+            }
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", (unsigned long long)stats.ReceivedCount);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", (unsigned long long)dropped);
+            hovered = hovered || ImGui::IsItemHovered();
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", (unsigned long long)stats.TransportErrorCount);
+
+            if (hovered) {
+                ImGui::BeginTooltip();
+                for (size_t i = 0; i < stats.DroppedCount.size(); i++) {
+                    ImGui::Text("%s: %llu", GetFrameDropReasonName((FrameDropReason)i),
+                                (unsigned long long)stats.DroppedCount[i]);
+                }
+                if (entry.Stream->GetFramePacingSettings().Enabled) {
+                    FramePacer::Stats pacing = entry.Stream->GetFramePacingStats();
+                    ImGui::Separator();
+                    ImGui::Text("Jitter %.1f ms, delay %.1f ms, %u queued", pacing.JitterMs,
+                                pacing.TargetDelayMs, pacing.QueuedFrames);
+                    ImGui::Text("Pacing: %llu dropped, %llu late",
+                                (unsigned long long)pacing.DroppedCount,
+                                (unsigned long long)pacing.LateCount);
+                }
+                ImGui::EndTooltip();
+            }
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+}
+
+}  // namespace ARcane
@@ -0,0 +1,101 @@
+#include "ARcane/Renderer/AsyncReadback.hpp"
+
+namespace ARcane {
+
+AsyncReadback::AsyncReadback(uint32_t ringSize) : m_Slots(ringSize) {
+    ARC_CORE_ASSERT(ringSize > 0, "AsyncReadback needs at least one buffer!");
+    for (auto& slot : m_Slots) {
+        glCreateBuffers(1, &slot.Buffer);
+    }
+}
+
+AsyncReadback::~AsyncReadback() {
+    for (auto& slot : m_Slots) {
+        if (slot.Fence) glDeleteSync(slot.Fence);
+        glDeleteBuffers(1, &slot.Buffer);
+    }
+}
+
+void AsyncReadback::SetMaxFrameRate(float fps) {
+    m_MinInterval = fps > 0.0f ? std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                     std::chrono::duration<float>(1.0f / fps))
+                               : std::chrono::steady_clock::duration(0);
+}
+
+bool AsyncReadback::Capture(uint32_t width, uint32_t height) {
+    auto now = std::chrono::steady_clock::now();
+    if (now - m_LastCapture < m_MinInterval) return false;
+
+    Slot& slot = m_Slots[m_Head];
+    if (slot.Fence) {
+        // Every buffer is still in flight: drop rather than wait on the GPU
+        m_DroppedCount++;
+        return false;
+    }
+    m_LastCapture = now;
+
+    uint32_t size = width * height * 4;
+    if (size > slot.Capacity) {
+        glNamedBufferData(slot.Buffer, size, nullptr, GL_STREAM_READ);
+        slot.Capacity = size;
+    }
+
+    // With a pack buffer bound, glReadPixels only queues a copy and returns immediately
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.Buffer);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.Width = width;
+    slot.Height = height;
+    slot.FrameIndex = m_FrameIndex++;
+
+    m_Head = (m_Head + 1) % m_Slots.size();
+    return true;
+}
+
+bool AsyncReadback::Capture(const Framebuffer& framebuffer) {
+    GLint previous = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous);
+
+    const auto& spec = framebuffer.GetSpecification();
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer.GetReadRendererID());
+    bool captured = Capture(spec.Width, spec.Height);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, previous);
+
+    return captured;
+}
+
+uint32_t AsyncReadback::Poll() {
+    uint32_t delivered = 0;
+
+    while (m_Slots[m_Tail].Fence) {
+        Slot& slot = m_Slots[m_Tail];
+
+        // Zero timeout: only checks the fence (and makes sure it has been submitted)
+        GLenum status = glClientWaitSync(slot.Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (status == GL_TIMEOUT_EXPIRED) break;
+
+        if (status == GL_WAIT_FAILED) {
+            ARC_CORE_ERROR("AsyncReadback: waiting on fence failed, frame {0} lost",
+                           slot.FrameIndex);
+        } else if (m_Callback) {
+            uint32_t size = slot.Width * slot.Height * 4;
+            const void* pixels = glMapNamedBufferRange(slot.Buffer, 0, size, GL_MAP_READ_BIT);
+            if (pixels) {
+                m_Callback(static_cast<const uint8_t*>(pixels), slot.Width, slot.Height,
+                           slot.FrameIndex);
+                glUnmapNamedBuffer(slot.Buffer);
+                delivered++;
+            }
+        }
+
+        glDeleteSync(slot.Fence);
+        slot.Fence = nullptr;
+        m_Tail = (m_Tail + 1) % m_Slots.size();
+    }
+
+    return delivered;
+}
+
+}  // namespace ARcane
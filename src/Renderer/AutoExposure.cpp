@@ -0,0 +1,137 @@
+#include "ARcane/Renderer/AutoExposure.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ARcane {
+
+// Must match LuminanceHistogram.glsl
+static constexpr uint32_t BinCount = 64;
+static constexpr float MinLog2 = -10.0f;
+static constexpr float MaxLog2 = 0.0f;
+static constexpr uint32_t WorkgroupSize = 16;
+
+// Metering does not need every pixel: about 256 x 256 samples whatever the frame size
+static constexpr uint32_t SamplesPerAxis = 256;
+
+AutoExposure::AutoExposure(const Ref<Shader>& histogramShader, uint32_t latency)
+    : m_Shader(histogramShader), m_Slots(latency), m_LastUpdate(std::chrono::steady_clock::now()) {
+    ARC_CORE_ASSERT(latency > 0, "AutoExposure needs at least one buffer!");
+    for (auto& slot : m_Slots) {
+        glCreateBuffers(1, &slot.Buffer);
+        glNamedBufferStorage(slot.Buffer, BinCount * sizeof(uint32_t), nullptr,
+                             GL_DYNAMIC_STORAGE_BIT | GL_MAP_READ_BIT);
+    }
+}
+
+AutoExposure::~AutoExposure() {
+    for (auto& slot : m_Slots) {
+        if (slot.Fence) glDeleteSync(slot.Fence);
+        glDeleteBuffers(1, &slot.Buffer);
+    }
+}
+
+bool AutoExposure::Measure(const Texture2D& texture, Source source) {
+    Slot& slot = m_Slots[m_Head];
+    if (slot.Fence) {
+        // Every buffer is still in flight: skip rather than wait on the GPU
+        m_SkippedCount++;
+        return false;
+    }
+
+    const uint32_t step =
+        std::max(std::max(texture.GetWidth(), texture.GetHeight()) / SamplesPerAxis, 1u);
+    const uint32_t columns = (texture.GetWidth() + step - 1) / step;
+    const uint32_t rows = (texture.GetHeight() + step - 1) / step;
+
+    glClearNamedBufferData(slot.Buffer, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, slot.Buffer);
+    texture.Bind(0);
+
+    m_Shader->Bind();
+    m_Shader->SetInt("u_Texture", 0);
+    m_Shader->SetInt("u_Source", (int)source);
+    m_Shader->SetInt("u_Step", (int)step);
+    glDispatchCompute((columns + WorkgroupSize - 1) / WorkgroupSize,
+                      (rows + WorkgroupSize - 1) / WorkgroupSize, 1);
+
+    // Makes the atomic writes visible to the mapping in Update()
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    slot.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    m_Head = (m_Head + 1) % m_Slots.size();
+    return true;
+}
+
+float AutoExposure::Update(float exposure, const AutoExposureSettings& settings) {
+    auto now = std::chrono::steady_clock::now();
+    float elapsed = std::chrono::duration<float>(now - m_LastUpdate).count();
+    m_LastUpdate = now;
+
+    // Only the newest finished histogram matters
+    while (m_Slots[m_Tail].Fence) {
+        Slot& slot = m_Slots[m_Tail];
+
+        // Zero timeout: only checks the fence (and makes sure it has been submitted)
+        GLenum status = glClientWaitSync(slot.Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (status == GL_TIMEOUT_EXPIRED) break;
+
+        if (status != GL_WAIT_FAILED) {
+            const void* bins = glMapNamedBufferRange(slot.Buffer, 0, BinCount * sizeof(uint32_t),
+                                                     GL_MAP_READ_BIT);
+            if (bins) {
+                float luminance = ComputeLuminance(static_cast<const uint32_t*>(bins), settings);
+                if (luminance > 0.0f) {
+                    m_MeasuredLuminance = luminance;
+                }
+                glUnmapNamedBuffer(slot.Buffer);
+            }
+        }
+
+        glDeleteSync(slot.Fence);
+        slot.Fence = nullptr;
+        m_Tail = (m_Tail + 1) % m_Slots.size();
+    }
+
+    if (m_MeasuredLuminance <= 0.0f) {
+        return exposure;
+    }
+
+    // Adapt in stops, exponentially: the same fraction of the remaining difference per second
+    // whatever the frame rate, so large jumps are quick at first and settle without overshoot
+    float target = std::clamp(settings.TargetLuminance / m_MeasuredLuminance,
+                              settings.MinExposure, settings.MaxExposure);
+    float current = std::log2(std::max(exposure, 1e-4f));
+    float blend = 1.0f - std::exp(-elapsed * settings.AdaptationRate);
+    return std::exp2(current + (std::log2(target) - current) * blend);
+}
+
+float AutoExposure::ComputeLuminance(const uint32_t* bins,
+                                     const AutoExposureSettings& settings) const {
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < BinCount; i++) {
+        total += bins[i];
+    }
+    if (total == 0) return 0.0f;
+
+    // Mean log luminance of the samples between the two percentiles, so a few specular
+    // highlights or black borders do not swing the exposure
+    const double low = total * (double)settings.LowPercentile;
+    const double high = total * (double)settings.HighPercentile;
+    double below = 0.0, weight = 0.0, sum = 0.0;
+    for (uint32_t i = 0; i < BinCount; i++) {
+        double count = bins[i];
+        double first = std::max(below, low);
+        double last = std::min(below + count, high);
+        below += count;
+        if (last <= first) continue;
+
+        float log2Luminance = i == 0 ? MinLog2
+                                     : MinLog2 + (i - 0.5f) / (BinCount - 1) * (MaxLog2 - MinLog2);
+        sum += (last - first) * log2Luminance;
+        weight += last - first;
+    }
+    return weight > 0.0 ? std::exp2((float)(sum / weight)) : 0.0f;
+}
+
+}  // namespace ARcane
@@ -0,0 +1,111 @@
+#include "ARcane/Renderer/Framebuffer.hpp"
+
+#include <glad/glad.h>
+
+namespace ARcane {
+
+Framebuffer::Framebuffer(const FramebufferSpecification& spec) : m_Specification(spec) {
+    Invalidate();
+}
+
+Framebuffer::~Framebuffer() { Release(); }
+
+void Framebuffer::Invalidate() {
+    Release();
+
+    const uint32_t width = m_Specification.Width;
+    const uint32_t height = m_Specification.Height;
+    const bool multisampled = m_Specification.Samples > 1;
+
+    glCreateFramebuffers(1, &m_RendererID);
+
+    // Color attachment
+    if (multisampled) {
+        glCreateTextures(GL_TEXTURE_2D_MULTISAMPLE, 1, &m_ColorAttachment);
+        glTextureStorage2DMultisample(m_ColorAttachment, m_Specification.Samples, GL_RGBA8, width,
+                                      height, GL_TRUE);
+    } else {
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_ColorAttachment);
+        glTextureStorage2D(m_ColorAttachment, 1, GL_RGBA8, width, height);
+        glTextureParameteri(m_ColorAttachment, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(m_ColorAttachment, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    }
+    glNamedFramebufferTexture(m_RendererID, GL_COLOR_ATTACHMENT0, m_ColorAttachment, 0);
+
+    // Depth attachment
+    if (m_Specification.DepthAttachment) {
+        glCreateRenderbuffers(1, &m_DepthAttachment);
+        glNamedRenderbufferStorageMultisample(m_DepthAttachment,
+                                              multisampled ? m_Specification.Samples : 0,
+                                              GL_DEPTH24_STENCIL8, width, height);
+        glNamedFramebufferRenderbuffer(m_RendererID, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER,
+                                       m_DepthAttachment);
+    }
+
+    ARC_CORE_ASSERT(glCheckNamedFramebufferStatus(m_RendererID, GL_FRAMEBUFFER) ==
+                        GL_FRAMEBUFFER_COMPLETE,
+                    "Framebuffer is incomplete!");
+
+    // Single-sampled target for the resolve blit
+    if (multisampled) {
+        glCreateFramebuffers(1, &m_ResolveRendererID);
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_ResolveColorAttachment);
+        glTextureStorage2D(m_ResolveColorAttachment, 1, GL_RGBA8, width, height);
+        glTextureParameteri(m_ResolveColorAttachment, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(m_ResolveColorAttachment, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glNamedFramebufferTexture(m_ResolveRendererID, GL_COLOR_ATTACHMENT0,
+                                  m_ResolveColorAttachment, 0);
+
+        ARC_CORE_ASSERT(glCheckNamedFramebufferStatus(m_ResolveRendererID, GL_FRAMEBUFFER) ==
+                            GL_FRAMEBUFFER_COMPLETE,
+                        "Resolve framebuffer is incomplete!");
+    }
+}
+
+void Framebuffer::Release() {
+    if (!m_RendererID) return;
+
+    glDeleteFramebuffers(1, &m_RendererID);
+    glDeleteTextures(1, &m_ColorAttachment);
+    glDeleteRenderbuffers(1, &m_DepthAttachment);
+    glDeleteFramebuffers(1, &m_ResolveRendererID);
+    glDeleteTextures(1, &m_ResolveColorAttachment);
+
+    m_RendererID = m_ColorAttachment = m_DepthAttachment = 0;
+    m_ResolveRendererID = m_ResolveColorAttachment = 0;
+}
+
+void Framebuffer::Bind() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+    glViewport(0, 0, m_Specification.Width, m_Specification.Height);
+}
+
+void Framebuffer::Unbind() const { glBindFramebuffer(GL_FRAMEBUFFER, 0); }
+
+void Framebuffer::Resize(uint32_t width, uint32_t height) {
+    if (width == 0 || height == 0) return;
+    if (width == m_Specification.Width && height == m_Specification.Height) return;
+
+    m_Specification.Width = width;
+    m_Specification.Height = height;
+    Invalidate();
+}
+
+void Framebuffer::Resolve() const {
+    if (!m_ResolveRendererID) return;
+
+    const GLint width = (GLint)m_Specification.Width;
+    const GLint height = (GLint)m_Specification.Height;
+    glBlitNamedFramebuffer(m_RendererID, m_ResolveRendererID, 0, 0, width, height, 0, 0, width,
+                           height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+}
+
+uint32_t Framebuffer::GetColorAttachmentRendererID() const {
+    return m_ResolveRendererID ? m_ResolveColorAttachment : m_ColorAttachment;
+}
+
+uint32_t Framebuffer::GetReadRendererID() const {
+    return m_ResolveRendererID ? m_ResolveRendererID : m_RendererID;
+}
+
+}  // namespace ARcane
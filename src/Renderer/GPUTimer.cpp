@@ -0,0 +1,71 @@
+#include "ARcane/Renderer/GPUTimer.hpp"
+
+#include <glad/glad.h>
+
+namespace ARcane {
+
+// The timer with an open GL_TIME_ELAPSED query, render thread only
+static GPUTimer* s_ActiveTimer = nullptr;
+
+GPUTimer::GPUTimer(uint32_t latency) : m_Queries(latency), m_Pending(latency, false) {
+    ARC_CORE_ASSERT(latency > 0, "GPUTimer needs at least one query!");
+    glCreateQueries(GL_TIME_ELAPSED, latency, m_Queries.data());
+}
+
+GPUTimer::~GPUTimer() {
+    m_NestedCount = 0;
+    End();
+    glDeleteQueries((GLsizei)m_Queries.size(), m_Queries.data());
+}
+
+void GPUTimer::Begin() {
+    // A nested query is a GL error, so a pass inside another timed pass is not measured
+    if (s_ActiveTimer) {
+        if (s_ActiveTimer == this) m_NestedCount++;
+        m_SkippedCount++;
+        return;
+    }
+
+    Resolve();
+
+    // Never block: if the oldest query has not come back yet, skip measuring this pass
+    if (m_Pending[m_Head]) {
+        m_SkippedCount++;
+        return;
+    }
+
+    glBeginQuery(GL_TIME_ELAPSED, m_Queries[m_Head]);
+    m_Active = true;
+    s_ActiveTimer = this;
+}
+
+void GPUTimer::End() {
+    if (!m_Active) return;
+    if (m_NestedCount > 0) {
+        m_NestedCount--;
+        return;
+    }
+
+    glEndQuery(GL_TIME_ELAPSED);
+    m_Pending[m_Head] = true;
+    m_Head = (m_Head + 1) % m_Queries.size();
+    m_Active = false;
+    s_ActiveTimer = nullptr;
+}
+
+void GPUTimer::Resolve() {
+    while (m_Pending[m_Tail]) {
+        GLint available = 0;
+        glGetQueryObjectiv(m_Queries[m_Tail], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+
+        GLuint64 elapsedNs = 0;
+        glGetQueryObjectui64v(m_Queries[m_Tail], GL_QUERY_RESULT, &elapsedNs);
+        m_ElapsedMs = (float)((double)elapsedNs / 1'000'000.0);
+
+        m_Pending[m_Tail] = false;
+        m_Tail = (m_Tail + 1) % m_Queries.size();
+    }
+}
+
+}  // namespace ARcane
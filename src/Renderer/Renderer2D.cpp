@@ -4,6 +4,11 @@
 #include "ARcane/Renderer/VertexArray.hpp"
 #include "ARcane/Renderer/Shader.hpp"
 #include "ARcane/Renderer/Renderer.hpp"
+#include "ARcane/Renderer/GPUTimer.hpp"
+#include "ARcane/Renderer/AutoExposure.hpp"
+#include "ARcane/Camera/CameraStream.hpp"
+
+#include <algorithm>
 
 namespace ARcane {
 
@@ -15,6 +20,38 @@ struct QuadVertex {
     float TilingFactor;
 };
 
+struct CameraVertex {
+    glm::vec3 Position;
+    glm::vec2 TexCoord;
+};
+
+// Must match the FORMAT_* constants in Camera.glsl
+enum class CameraShaderFormat : int { RGB = 0, NV12 = 1, YUYV = 2, I420 = 3 };
+static constexpr uint32_t RemapTextureSlot = 3;  // After the three frame planes
+
+struct CameraStreamTexture {
+    Ref<Texture2D> Planes[3];  // Y, UV for NV12, Y, U, V for I420, otherwise only the first
+    CameraShaderFormat Format = CameraShaderFormat::RGB;
+    glm::vec2 FrameSize = glm::vec2(0.0f);  // In pixels, the planes may be smaller
+    FrameInfo Info;  // Frame currently in the textures
+
+    Ref<Texture2D> Remap;  // Undistortion map, built from the stream's intrinsics
+    uint32_t RemapVersion = 0;
+    std::weak_ptr<const void> Lifetime;  // Of the stream the entry belongs to
+
+    Scope<AutoExposure> Exposure;  // Created when the stream enables auto exposure
+};
+
+struct PresentedFrame {
+    CameraStream* Stream;
+    std::weak_ptr<const void> Lifetime;  // Expired if the stream was destroyed before the swap
+    FrameInfo Info;
+};
+
+static bool IsSameOwner(const std::weak_ptr<const void>& a, const std::weak_ptr<const void>& b) {
+    return !a.owner_before(b) && !b.owner_before(a);
+}
+
 struct Renderer2DData {
     inline static const uint32_t MaxQuads = 10'000;
     inline static const uint32_t MaxVertices = MaxQuads * 4;
@@ -26,6 +63,14 @@ struct Renderer2DData {
     Ref<VertexBuffer> QuadVertexBuffer;
     Ref<Shader> TextureShader;
     Ref<Texture2D> WhiteTexture;
+    Scope<GPUTimer> SceneTimer;
+
+    // Camera frames are drawn one quad at a time with their own shader, which converts YUV on the
+    // GPU instead of on the decode thread
+    Ref<VertexArray> CameraVertexArray;
+    Ref<VertexBuffer> CameraVertexBuffer;
+    Ref<Shader> CameraShader;
+    Ref<Shader> LuminanceHistogramShader;  // Compiled for the first auto exposure stream
 
     uint32_t QuadIndexCount = 0;
     QuadVertex* QuadVertexBufferBase = nullptr;
@@ -36,11 +81,52 @@ struct Renderer2DData {
 
     glm::vec4 QuadVertexPositions[4];
 
+    glm::mat4 ViewProjection = glm::mat4(1.0f);
+    bool CullingEnabled = false;
+
+    std::unordered_map<const CameraStream*, CameraStreamTexture> StreamTextures;
+    std::vector<PresentedFrame> PresentedFrames;  // Drawn this frame, waiting for the swap
+    uint64_t LastPresentNs = 0;
+    double PresentIntervalNs = 0.0;
+    uint64_t NextPresentNs = 0;  // Expected time of the next swap
+
     Renderer2D::Statistics Stats;
 };
 
 static Renderer2DData s_Data;
 
+// Tests a quad against the clip volume of the current scene. The four corners are gathered into
+// SoA lanes (all x, all y, ...) so every plane test is a single 4-wide compare that the compiler
+// can keep in vector registers. The test is conservative: a quad is only rejected when all of its
+// corners lie outside the same plane.
+static bool IsQuadVisible(const glm::mat4& transform) {
+    const glm::mat4 mvp = s_Data.ViewProjection * transform;
+
+    glm::vec4 x, y, z, w;
+    for (int i = 0; i < 4; i++) {
+        const glm::vec4 clip = mvp * s_Data.QuadVertexPositions[i];
+        x[i] = clip.x;
+        y[i] = clip.y;
+        z[i] = clip.z;
+        w[i] = clip.w;
+    }
+
+    const glm::vec4 negW = -w;
+    if (glm::all(glm::lessThan(x, negW)) || glm::all(glm::greaterThan(x, w))) return false;
+    if (glm::all(glm::lessThan(y, negW)) || glm::all(glm::greaterThan(y, w))) return false;
+    if (glm::all(glm::lessThan(z, negW)) || glm::all(glm::greaterThan(z, w))) return false;
+
+    return true;
+}
+
+// Returns true (and counts the quad) when culling is enabled and the quad is off-screen
+static bool CullQuad(const glm::mat4& transform) {
+    if (!s_Data.CullingEnabled || IsQuadVisible(transform)) return false;
+
+    s_Data.Stats.CulledQuadCount++;
+    return true;
+}
+
 void Renderer2D::Init() {
     s_Data.QuadVertexArray = CreateRef<VertexArray>();
 
@@ -91,26 +177,54 @@ void Renderer2D::Init() {
     s_Data.QuadVertexPositions[1] = {0.5f, -0.5f, 0.0f, 1.0f};
     s_Data.QuadVertexPositions[2] = {0.5f, 0.5f, 0.0f, 1.0f};
     s_Data.QuadVertexPositions[3] = {-0.5f, 0.5f, 0.0f, 1.0f};
+
+    s_Data.CameraVertexArray = CreateRef<VertexArray>();
+    s_Data.CameraVertexBuffer = CreateRef<VertexBuffer>(4 * sizeof(CameraVertex));
+    s_Data.CameraVertexBuffer->SetLayout({
+        {ShaderDataType::Float3, "a_Position"},
+        {ShaderDataType::Float2, "a_TexCoord"},
+    });
+    s_Data.CameraVertexArray->AddVertexBuffer(s_Data.CameraVertexBuffer);
+
+    uint32_t cameraIndices[6] = {0, 1, 2, 2, 3, 0};
+    s_Data.CameraVertexArray->SetIndexBuffer(CreateRef<IndexBuffer>(cameraIndices, 6));
+
+    s_Data.CameraShader = CreateRef<Shader>(ARC_ASSET_PATH("shaders/Camera.glsl"));
+    s_Data.CameraShader->Bind();
+    s_Data.CameraShader->SetInt("u_Plane0", 0);
+    s_Data.CameraShader->SetInt("u_Plane1", 1);
+    s_Data.CameraShader->SetInt("u_Plane2", 2);
+    s_Data.CameraShader->SetInt("u_Remap", RemapTextureSlot);
+
+    s_Data.SceneTimer = CreateScope<GPUTimer>();
 }
 
-void Renderer2D::Shutdown() { delete[] s_Data.QuadVertexBufferBase; }
+void Renderer2D::Shutdown() {
+    s_Data.SceneTimer.reset();
+    s_Data.StreamTextures.clear();
+    s_Data.LuminanceHistogramShader.reset();
+    delete[] s_Data.QuadVertexBufferBase;
+}
 
 void Renderer2D::BeginScene(const Camera& camera) {
+    s_Data.CameraShader->Bind();
+    s_Data.CameraShader->SetMat4("u_ViewProjection", camera.GetProjectionMatrix());
+
     s_Data.TextureShader->Bind();
     s_Data.TextureShader->SetMat4("u_ViewProjection", camera.GetProjectionMatrix());
+    s_Data.ViewProjection = camera.GetProjectionMatrix();
 
     s_Data.QuadIndexCount = 0;
     s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;
 
     s_Data.TextureSlotIndex = 1;
+
+    s_Data.SceneTimer->Begin();
 }
 
 void Renderer2D::EndScene() {
-    uint32_t dataSize =
-        (uint32_t)((uint8_t*)s_Data.QuadVertexBufferPtr - (uint8_t*)s_Data.QuadVertexBufferBase);
-    s_Data.QuadVertexBuffer->SetData(s_Data.QuadVertexBufferBase, dataSize);
-
-    Flush();
+    UploadAndFlush(FlushReason::EndOfScene);
+    s_Data.SceneTimer->End();
 }
 
 void Renderer2D::Flush() {
@@ -118,13 +232,40 @@ void Renderer2D::Flush() {
     for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++) {
         s_Data.TextureSlots[i]->Bind(i);
     }
+    s_Data.Stats.TextureBinds += s_Data.TextureSlotIndex;
 
+    s_Data.QuadVertexArray->Bind();
     Renderer::DrawIndexed(s_Data.QuadVertexArray, s_Data.QuadIndexCount);
     s_Data.Stats.DrawCalls++;
 }
 
-void Renderer2D::FlushAndReset() {
-    EndScene();
+void Renderer2D::UploadAndFlush(FlushReason reason) {
+    ARC_PROFILE_FUNCTION();
+    uint32_t dataSize =
+        (uint32_t)((uint8_t*)s_Data.QuadVertexBufferPtr - (uint8_t*)s_Data.QuadVertexBufferBase);
+    s_Data.QuadVertexBuffer->SetData(s_Data.QuadVertexBufferBase, dataSize);
+    s_Data.Stats.VertexBytesUploaded += dataSize;
+
+    switch (reason) {
+        case FlushReason::BufferFull:
+            s_Data.Stats.FlushesBufferFull++;
+            break;
+        case FlushReason::TextureSlotsFull:
+            s_Data.Stats.FlushesTextureSlotsFull++;
+            break;
+        case FlushReason::EndOfScene:
+            s_Data.Stats.FlushesEndOfScene++;
+            break;
+        case FlushReason::CameraQuad:
+            s_Data.Stats.FlushesCameraQuad++;
+            break;
+    }
+
+    Flush();
+}
+
+void Renderer2D::FlushAndReset(FlushReason reason) {
+    UploadAndFlush(reason);
 
     s_Data.QuadIndexCount = 0;
     s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;
@@ -143,15 +284,10 @@ void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size,
     DrawQuad({position.x, position.y, 0.0f}, size, texture, tilingFactor, tintColor);
 }
 
-void Renderer2D::DrawCVMat(const cv::Mat& frame, const glm::vec3& position, const glm::vec2& size) {
-    // Convert the frame from BGR (or grayscale) to RGBA
+// Converts a BGR, grayscale or RGBA frame to bottom-up RGBA and uploads it, recreating the
+// texture when the frame size changes. Frames already bottom-up are not flipped.
+static void UploadCVMat(const cv::Mat& frame, Ref<Texture2D>& texture, bool bottomUp = false) {
     cv::Mat frameRGBA;
-
-    if (frame.empty()) {
-        ARC_CORE_WARN("Empty frame passed to DrawCVMat");
-        return;
-    }
-
     if (frame.channels() == 3)
         cv::cvtColor(frame, frameRGBA, cv::COLOR_BGR2RGBA);
     else if (frame.channels() == 1)
@@ -161,32 +297,301 @@ void Renderer2D::DrawCVMat(const cv::Mat& frame, const glm::vec3& position, cons
     else
         frameRGBA = frame;  // fallback for unexpected formats
 
-    cv::flip(frameRGBA, frameRGBA, 0);  // flip the frame vertically
+    if (!bottomUp) {
+        cv::flip(frameRGBA, frameRGBA, 0);  // flip the frame vertically
+    }
 
-    // If the camera texture is not yet created or the frame dimensions have changed, create a new
-    // texture
-    if (!Renderer2DData::s_CameraTexture ||
-        Renderer2DData::s_CameraTexture->GetWidth() != (uint32_t)frameRGBA.cols ||
-        Renderer2DData::s_CameraTexture->GetHeight() != (uint32_t)frameRGBA.rows) {
-        Renderer2DData::s_CameraTexture = CreateRef<Texture2D>(frameRGBA.cols, frameRGBA.rows);
+    // If the texture is not yet created or the frame dimensions have changed, create a new one
+    if (!texture || texture->GetWidth() != (uint32_t)frameRGBA.cols ||
+        texture->GetHeight() != (uint32_t)frameRGBA.rows) {
+        texture = CreateRef<Texture2D>(frameRGBA.cols, frameRGBA.rows);
     }
 
     // Update the texture with the new frame data.
     // Note: total() * elemSize() gives the size in bytes.
-    Renderer2DData::s_CameraTexture->SetData(
-        frameRGBA.data, static_cast<uint32_t>(frameRGBA.total() * frameRGBA.elemSize()));
+    uint32_t frameSize = static_cast<uint32_t>(frameRGBA.total() * frameRGBA.elemSize());
+    texture->SetData(frameRGBA.data, frameSize);
+    s_Data.Stats.TextureBytesUploaded += frameSize;
+}
+
+void Renderer2D::DrawCVMat(const cv::Mat& frame, const glm::vec3& position, const glm::vec2& size) {
+    if (frame.empty()) {
+        ARC_CORE_WARN("Empty frame passed to DrawCVMat");
+        return;
+    }
+
+    // Skip the color conversion and texture upload entirely if the frame is off-screen
+    glm::mat4 transform = glm::translate(glm::mat4(1.0f), position) *
+                          glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f});
+    if (CullQuad(transform)) {
+        return;
+    }
+
+    UploadCVMat(frame, Renderer2DData::s_CameraTexture);
 
     // Draw the camera frame as a quad
     DrawQuad(position, size, Renderer2DData::s_CameraTexture);
 }
 
-void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size,
-                          const glm::vec4& color) {
-    // Check if we need to flush the current batch (if full) and start a new one
-    if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices) {
-        FlushAndReset();
+// Uploads a plane of a raw frame, recreating the texture when the size or format changes
+static void UploadPlane(const uint8_t* data, uint32_t width, uint32_t height, TextureFormat format,
+                        Ref<Texture2D>& texture) {
+    if (!texture || texture->GetWidth() != width || texture->GetHeight() != height ||
+        texture->GetFormat() != format) {
+        texture = CreateRef<Texture2D>(width, height, format);
+    }
+
+    uint32_t bytesPerPixel = 4;
+    if (format == TextureFormat::BGR8)
+        bytesPerPixel = 3;
+    else if (format == TextureFormat::RG8)
+        bytesPerPixel = 2;
+    else if (format == TextureFormat::R8)
+        bytesPerPixel = 1;
+
+    uint32_t size = width * height * bytesPerPixel;
+    texture->SetData(const_cast<uint8_t*>(data), size);
+    s_Data.Stats.TextureBytesUploaded += size;
+}
+
+// Builds the undistortion map: for each position of the undistorted image, where it lies in the
+// camera image, both normalized. The map is smooth, so a quarter of the calibration resolution
+// sampled with linear filtering is within a fraction of a pixel, and it only costs a few
+// milliseconds when the intrinsics change instead of a remap pass on every frame.
+static Ref<Texture2D> BuildRemapTexture(const CameraIntrinsics& intrinsics) {
+    const uint32_t width = std::max((uint32_t)intrinsics.ImageSize.x / 4, 2u);
+    const uint32_t height = std::max((uint32_t)intrinsics.ImageSize.y / 4, 2u);
+
+    std::vector<glm::vec2> map((size_t)width * height);
+    const glm::vec2 scale = intrinsics.ImageSize / glm::vec2((float)width, (float)height);
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < width; x++) {
+            // Texel centers, in pixels of the calibration image. Texture coordinates put pixel
+            // centers at +0.5, the OpenCV camera model at integer coordinates.
+            glm::vec2 pixel = (glm::vec2((float)x, (float)y) + 0.5f) * scale - 0.5f;
+            map[(size_t)y * width + x] = (intrinsics.Distort(pixel) + 0.5f) / intrinsics.ImageSize;
+        }
+    }
+
+    auto texture = CreateRef<Texture2D>(width, height, TextureFormat::RG32F);
+    uint32_t size = (uint32_t)(map.size() * sizeof(glm::vec2));
+    texture->SetData(map.data(), size);
+    s_Data.Stats.TextureBytesUploaded += size;
+    return texture;
+}
+
+// Uploads a stream frame as-is. Color conversion and the vertical flip happen in the camera
+// shader, so no CPU pass touches the pixels between the decoder and the driver.
+static void UploadStreamFrame(const cv::Mat& frame, const FrameInfo& info,
+                              CameraStreamTexture& entry) {
+    const uint8_t* data = frame.data;
+    entry.FrameSize = {(float)frame.cols, (float)frame.rows};
+    switch (info.Format) {
+        case FramePixelFormat::BGR:
+            UploadPlane(data, frame.cols, frame.rows, TextureFormat::BGR8, entry.Planes[0]);
+            entry.Format = CameraShaderFormat::RGB;
+            break;
+        case FramePixelFormat::RGBA:
+            UploadPlane(data, frame.cols, frame.rows, TextureFormat::RGBA8, entry.Planes[0]);
+            entry.Format = CameraShaderFormat::RGB;
+            break;
+        case FramePixelFormat::NV12: {
+            // Y plane followed by the interleaved UV plane at half resolution
+            uint32_t width = frame.cols;
+            uint32_t height = frame.rows * 2 / 3;
+            entry.FrameSize.y = (float)height;
+            UploadPlane(data, width, height, TextureFormat::R8, entry.Planes[0]);
+            UploadPlane(data + (size_t)width * height, width / 2, height / 2, TextureFormat::RG8,
+                        entry.Planes[1]);
+            entry.Format = CameraShaderFormat::NV12;
+            break;
+        }
+        case FramePixelFormat::I420: {
+            // Y plane followed by the U and V planes at half resolution
+            uint32_t width = frame.cols;
+            uint32_t height = frame.rows * 2 / 3;
+            size_t chromaSize = (size_t)(width / 2) * (height / 2);
+            entry.FrameSize.y = (float)height;
+            UploadPlane(data, width, height, TextureFormat::R8, entry.Planes[0]);
+            data += (size_t)width * height;
+            UploadPlane(data, width / 2, height / 2, TextureFormat::R8, entry.Planes[1]);
+            UploadPlane(data + chromaSize, width / 2, height / 2, TextureFormat::R8,
+                        entry.Planes[2]);
+            entry.Format = CameraShaderFormat::I420;
+            break;
+        }
+        case FramePixelFormat::YUYV:
+            // Two pixels per RGBA texel
+            UploadPlane(data, frame.cols / 2, frame.rows, TextureFormat::RGBA8, entry.Planes[0]);
+            entry.Format = CameraShaderFormat::YUYV;
+            break;
+    }
+}
+
+// Queues the luminance histogram of the frame just uploaded; the luma plane is enough for YUV
+static void MeasureExposure(CameraStreamTexture& entry) {
+    if (!entry.Exposure) {
+        if (!s_Data.LuminanceHistogramShader) {
+            s_Data.LuminanceHistogramShader =
+                CreateRef<Shader>(ARC_ASSET_PATH("shaders/LuminanceHistogram.glsl"));
+        }
+        entry.Exposure = CreateScope<AutoExposure>(s_Data.LuminanceHistogramShader);
+    }
+
+    AutoExposure::Source source = AutoExposure::Source::RGB;
+    if (entry.Format == CameraShaderFormat::NV12 || entry.Format == CameraShaderFormat::I420)
+        source = AutoExposure::Source::Y;
+    else if (entry.Format == CameraShaderFormat::YUYV)
+        source = AutoExposure::Source::YUYV;
+    entry.Exposure->Measure(*entry.Planes[0], source);
+
+    // Quads batched so far are still flushed with the texture shader
+    s_Data.TextureShader->Bind();
+}
+
+void Renderer2D::DrawCameraStream(CameraStream& stream, const glm::vec3& position,
+                                  const glm::vec2& size) {
+    ARC_PROFILE_FUNCTION();
+    glm::mat4 transform = glm::translate(glm::mat4(1.0f), position) *
+                          glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f});
+    if (CullQuad(transform)) {
+        return;
+    }
+
+    // Nothing decoded yet
+    uint64_t frameIndex = stream.GetFrameIndex();
+    if (frameIndex == 0) {
+        return;
+    }
+
+    // A new stream may have been allocated at the address of a destroyed one, it must not
+    // inherit its textures
+    std::weak_ptr<const void> lifetime = stream.GetLifetime();
+    CameraStreamTexture& entry = s_Data.StreamTextures[&stream];
+    if (!IsSameOwner(entry.Lifetime, lifetime)) {
+        entry = CameraStreamTexture();
+        entry.Lifetime = lifetime;
+    }
+    if (frameIndex != entry.Info.Index) {
+        // Uploaded straight from the stream's buffer, which is returned once the handle goes.
+        // A paced stream may have nothing due yet, the previous frame stays up then.
+        FrameInfo info;
+        FrameBuffer frame = stream.AcquireFrame(info, s_Data.NextPresentNs);
+        if (frame && info.Index != entry.Info.Index && frame.GetMat().isContinuous()) {
+            UploadStreamFrame(frame.GetMat(), info, entry);
+            stream.RecordUploaded(info, GetSteadyClockNs());
+            entry.Info = info;
+            if (stream.IsAutoExposureEnabled()) {
+                MeasureExposure(entry);
+            }
+        }
+    }
+    if (!entry.Planes[0]) {
+        return;
+    }
+    if (stream.IsAutoExposureEnabled() && entry.Exposure) {
+        stream.GetExposure() =
+            entry.Exposure->Update(stream.GetExposure(), stream.GetAutoExposureSettings());
+    }
+
+    // Keep the draw order: everything batched so far goes out before the camera quad
+    if (s_Data.QuadIndexCount > 0) {
+        FlushAndReset(FlushReason::CameraQuad);
     }
 
+    // Frames are stored top-down unless the decoder already flipped them
+    float top = entry.Info.BottomUp ? 1.0f : 0.0f;
+    float bottom = 1.0f - top;
+
+    CameraVertex vertices[4];
+    const glm::vec2 texCoords[4] = {{0.0f, bottom}, {1.0f, bottom}, {1.0f, top}, {0.0f, top}};
+    for (int i = 0; i < 4; i++) {
+        vertices[i].Position = transform * s_Data.QuadVertexPositions[i];
+        vertices[i].TexCoord = texCoords[i];
+    }
+    s_Data.CameraVertexBuffer->SetData(vertices, sizeof(vertices));
+    s_Data.Stats.VertexBytesUploaded += sizeof(vertices);
+
+    s_Data.CameraShader->Bind();
+    s_Data.CameraShader->SetInt("u_Format", (int)entry.Format);
+    s_Data.CameraShader->SetFloat2("u_FrameSize", entry.FrameSize);
+    uint32_t planeCount = 1;
+    if (entry.Format == CameraShaderFormat::NV12)
+        planeCount = 2;
+    else if (entry.Format == CameraShaderFormat::I420)
+        planeCount = 3;
+    for (uint32_t i = 0; i < planeCount; i++) {
+        entry.Planes[i]->Bind(i);
+    }
+    s_Data.Stats.TextureBinds += planeCount;
+
+    // Undistortion is a lookup in the camera shader, the map is only rebuilt when the intrinsics
+    // change
+    const CameraIntrinsics& intrinsics = stream.GetIntrinsics();
+    bool undistort = intrinsics.IsValid() && intrinsics.HasDistortion();
+    if (undistort) {
+        if (!entry.Remap || entry.RemapVersion != stream.GetIntrinsicsVersion()) {
+            entry.Remap = BuildRemapTexture(intrinsics);
+            entry.RemapVersion = stream.GetIntrinsicsVersion();
+        }
+        entry.Remap->Bind(RemapTextureSlot);
+        s_Data.Stats.TextureBinds++;
+    }
+    s_Data.CameraShader->SetInt("u_Undistort", undistort);
+    s_Data.CameraShader->SetInt("u_BottomUp", entry.Info.BottomUp);
+
+    // Image adjustments run in the same pass, and cost a single branch when neutral
+    bool adjust = stream.HasImageAdjustments();
+    s_Data.CameraShader->SetInt("u_Adjust", adjust);
+    if (adjust) {
+        const ImageAdjustments& adjustments = stream.GetImageAdjustments();
+        s_Data.CameraShader->SetFloat("u_Exposure", stream.GetExposure());
+        s_Data.CameraShader->SetFloat3("u_WhiteBalance", adjustments.WhiteBalance);
+        s_Data.CameraShader->SetFloat("u_Contrast", adjustments.Contrast);
+        s_Data.CameraShader->SetFloat("u_Gamma", std::max(adjustments.Gamma, 0.01f));
+        s_Data.CameraShader->SetFloat("u_Sharpen", adjustments.Sharpen);
+        s_Data.CameraShader->SetFloat("u_SharpenRadius", adjustments.SharpenRadius);
+        s_Data.CameraShader->SetInt("u_FalseColor", adjustments.FalseColor);
+    }
+
+    s_Data.CameraVertexArray->Bind();
+    Renderer::DrawIndexed(s_Data.CameraVertexArray, 6);
+    s_Data.Stats.DrawCalls++;
+    s_Data.Stats.QuadCount++;
+
+    s_Data.TextureShader->Bind();
+    s_Data.PresentedFrames.push_back({&stream, lifetime, entry.Info});
+}
+
+void Renderer2D::OnFramePresented() {
+    uint64_t now = GetSteadyClockNs();
+
+    // Predict when the next swap reaches the screen, for paced camera streams. The interval is
+    // smoothed so a single slow frame does not shift the prediction.
+    if (s_Data.LastPresentNs) {
+        double interval = (double)(now - s_Data.LastPresentNs);
+        s_Data.PresentIntervalNs += s_Data.PresentIntervalNs > 0.0
+                                        ? (interval - s_Data.PresentIntervalNs) / 8.0
+                                        : interval;
+    }
+    s_Data.LastPresentNs = now;
+    s_Data.NextPresentNs = now + (uint64_t)s_Data.PresentIntervalNs;
+
+    for (auto& presented : s_Data.PresentedFrames) {
+        if (!presented.Lifetime.expired()) {
+            presented.Stream->RecordPresented(presented.Info, now);
+        }
+    }
+    s_Data.PresentedFrames.clear();
+
+    // Textures of destroyed streams are freed here, on the render thread with the context current
+    for (auto it = s_Data.StreamTextures.begin(); it != s_Data.StreamTextures.end();) {
+        it = it->second.Lifetime.expired() ? s_Data.StreamTextures.erase(it) : std::next(it);
+    }
+}
+
+void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size,
+                          const glm::vec4& color) {
     const float textureIndex = 0.0f;
     const float tilingFactor = 1.0f;
     const float rotation = 0.0f;
@@ -195,6 +600,15 @@ void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size,
                           glm::rotate(glm::mat4(1.0f), rotation, {0.0f, 0.0f, 1.0f}) *
                           glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f});
 
+    if (CullQuad(transform)) {
+        return;
+    }
+
+    // Check if we need to flush the current batch (if full) and start a new one
+    if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices) {
+        FlushAndReset(FlushReason::BufferFull);
+    }
+
     s_Data.QuadVertexBufferPtr->Position = transform * s_Data.QuadVertexPositions[0];
     s_Data.QuadVertexBufferPtr->Color = color;
     s_Data.QuadVertexBufferPtr->TexCoord = {0.0f, 0.0f};
@@ -230,15 +644,23 @@ void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size,
 
 void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size,
                           const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4) {
-    // Check if we need to flush the current batch (if full) and start a new one
-    if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices) {
-        FlushAndReset();
-    }
-
     float textureIndex = 0.0f;
     const float rotation = 0.0f;
     constexpr glm::vec4 color = {1.0f, 1.0f, 1.0f, 1.0f};
 
+    glm::mat4 transform = glm::translate(glm::mat4(1.0f), position) *
+                          glm::rotate(glm::mat4(1.0f), rotation, {0.0f, 0.0f, 1.0f}) *
+                          glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f});
+
+    if (CullQuad(transform)) {
+        return;
+    }
+
+    // Check if we need to flush the current batch (if full) and start a new one
+    if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices) {
+        FlushAndReset(FlushReason::BufferFull);
+    }
+
     // Check if texture is already in the texture slots
     for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++) {
         if (*s_Data.TextureSlots[i].get() == *texture.get()) {
@@ -247,17 +669,17 @@ void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size,
         }
     }
 
-    // If texture is not in the texture slots, add it
+    // If texture is not in the texture slots, add it (starting a new batch if they are all taken)
     if (textureIndex == 0.0f) {
+        if (s_Data.TextureSlotIndex >= Renderer2DData::MaxTextureSlots) {
+            FlushAndReset(FlushReason::TextureSlotsFull);
+        }
+
         textureIndex = (float)s_Data.TextureSlotIndex;
         s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
         s_Data.TextureSlotIndex++;
     }
 
-    glm::mat4 transform = glm::translate(glm::mat4(1.0f), position) *
-                          glm::rotate(glm::mat4(1.0f), rotation, {0.0f, 0.0f, 1.0f}) *
-                          glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f});
-
     s_Data.QuadVertexBufferPtr->Position = transform * s_Data.QuadVertexPositions[0];
     s_Data.QuadVertexBufferPtr->Color = color;
     s_Data.QuadVertexBufferPtr->TexCoord = {0.0f, 0.0f};
@@ -298,11 +720,6 @@ void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& siz
 
 void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation,
                                  const glm::vec4& color) {
-    // Check if we need to flush the current batch (if full) and start a new one
-    if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices) {
-        FlushAndReset();
-    }
-
     float textureIndex = 0.0f;
     float tilingFactor = 1.0f;
 
@@ -310,6 +727,15 @@ void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& siz
                           glm::rotate(glm::mat4(1.0f), rotation, {0.0f, 0.0f, 1.0f}) *
                           glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f});
 
+    if (CullQuad(transform)) {
+        return;
+    }
+
+    // Check if we need to flush the current batch (if full) and start a new one
+    if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices) {
+        FlushAndReset(FlushReason::BufferFull);
+    }
+
     s_Data.QuadVertexBufferPtr->Position = transform * s_Data.QuadVertexPositions[0];
     s_Data.QuadVertexBufferPtr->Color = color;
     s_Data.QuadVertexBufferPtr->TexCoord = {0.0f, 0.0f};
@@ -353,14 +779,22 @@ void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& siz
 void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation,
                                  const Ref<Texture2D>& texture, float tilingFactor,
                                  const glm::vec4&) {
+    constexpr glm::vec4 color = {1.0f, 1.0f, 1.0f, 1.0f};
+    float textureIndex = 0.0f;
+
+    glm::mat4 transform = glm::translate(glm::mat4(1.0f), position) *
+                          glm::rotate(glm::mat4(1.0f), rotation, {0.0f, 0.0f, 1.0f}) *
+                          glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f});
+
+    if (CullQuad(transform)) {
+        return;
+    }
+
     // Check if we need to flush the current batch (if full) and start a new one
     if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices) {
-        FlushAndReset();
+        FlushAndReset(FlushReason::BufferFull);
     }
 
-    constexpr glm::vec4 color = {1.0f, 1.0f, 1.0f, 1.0f};
-    float textureIndex = 0.0f;
-
     // Check if texture is already in the texture slots
     for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++) {
         if (*s_Data.TextureSlots[i].get() == *texture.get()) {
@@ -369,17 +803,17 @@ void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& siz
         }
     }
 
-    // If texture is not in the texture slots, add it
+    // If texture is not in the texture slots, add it (starting a new batch if they are all taken)
     if (textureIndex == 0.0f) {
+        if (s_Data.TextureSlotIndex >= Renderer2DData::MaxTextureSlots) {
+            FlushAndReset(FlushReason::TextureSlotsFull);
+        }
+
         textureIndex = (float)s_Data.TextureSlotIndex;
         s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
         s_Data.TextureSlotIndex++;
     }
 
-    glm::mat4 transform = glm::translate(glm::mat4(1.0f), position) *
-                          glm::rotate(glm::mat4(1.0f), rotation, {0.0f, 0.0f, 1.0f}) *
-                          glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f});
-
     s_Data.QuadVertexBufferPtr->Position = transform * s_Data.QuadVertexPositions[0];
     s_Data.QuadVertexBufferPtr->Color = color;
     s_Data.QuadVertexBufferPtr->TexCoord = {0.0f, 0.0f};
@@ -413,8 +847,16 @@ void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& siz
     s_Data.Stats.QuadCount++;
 }
 
-void Renderer2D::ResetStats() { memset(&s_Data.Stats, 0, sizeof(Statistics)); }
+void Renderer2D::SetCullingEnabled(bool enabled) { s_Data.CullingEnabled = enabled; }
 
-Renderer2D::Statistics Renderer2D::GetStats() { return s_Data.Stats; }
+bool Renderer2D::IsCullingEnabled() { return s_Data.CullingEnabled; }
+
+void Renderer2D::ResetStats() { s_Data.Stats = Statistics(); }
+
+Renderer2D::Statistics Renderer2D::GetStats() {
+    Statistics stats = s_Data.Stats;
+    stats.GPUTimeMs = s_Data.SceneTimer ? s_Data.SceneTimer->GetElapsedMs() : 0.0f;
+    return stats;
+}
 
 }  // namespace ARcane
\ No newline at end of file
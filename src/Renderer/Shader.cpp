@@ -8,6 +8,7 @@ namespace ARcane {
 static GLenum ShaderTypeFromString(const std::string &type) {
     if (type == "vertex") return GL_VERTEX_SHADER;
     if (type == "fragment" || type == "pixel") return GL_FRAGMENT_SHADER;
+    if (type == "compute") return GL_COMPUTE_SHADER;
 
     ARC_CORE_ASSERT(false, "Unknown shader type!");
     return 0;
@@ -61,7 +62,8 @@ std::unordered_map<GLenum, std::string> Shader::PreProcess(const std::string &so
         std::string type = source.substr(begin, eol - begin);
 
         // Ensure the shader type is valid
-        ARC_CORE_ASSERT(type == "vertex" || type == "fragment" || type == "pixel",
+        ARC_CORE_ASSERT(type == "vertex" || type == "fragment" || type == "pixel" ||
+                            type == "compute",
                         "Invalid shader type specified");
 
         // Find the start of the next line after the type declaration
@@ -4,15 +4,46 @@
 
 namespace ARcane {
 
-Texture2D::Texture2D(uint32_t width, uint32_t height)
-    : m_Width(width), m_Height(height), m_InternalFormat(GL_RGBA), m_DataFormat(GL_RGBA) {
+Texture2D::Texture2D(uint32_t width, uint32_t height, TextureFormat format)
+    : m_Width(width), m_Height(height), m_Format(format) {
+    switch (format) {
+        case TextureFormat::RGBA8:
+            m_InternalFormat = GL_RGBA8;
+            m_DataFormat = GL_RGBA;
+            break;
+        case TextureFormat::BGR8:
+            m_InternalFormat = GL_RGB8;
+            m_DataFormat = GL_BGR;
+            break;
+        case TextureFormat::RG8:
+            m_InternalFormat = GL_RG8;
+            m_DataFormat = GL_RG;
+            break;
+        case TextureFormat::R8:
+            m_InternalFormat = GL_R8;
+            m_DataFormat = GL_RED;
+            break;
+        case TextureFormat::RG32F:
+            m_InternalFormat = GL_RG32F;
+            m_DataFormat = GL_RG;
+            m_DataType = GL_FLOAT;
+            break;
+    }
+
     glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
-    glTextureStorage2D(m_RendererID, 1, GL_RGBA8, m_Width, m_Height);
+    glTextureStorage2D(m_RendererID, 1, m_InternalFormat, m_Width, m_Height);
     // Set texture parameters
     glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+    // Lookup tables are interpolated between their entries and never wrap around
+    if (format == TextureFormat::RG32F) {
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
 }
 
 Texture2D::Texture2D(const std::string& path) : m_Path(path) {
@@ -64,8 +95,13 @@ Texture2D::~Texture2D() { glDeleteTextures(1, &m_RendererID); }
 void Texture2D::Bind(uint32_t slot) const { glBindTextureUnit(slot, m_RendererID); }
 
 void Texture2D::SetData(void* data, uint32_t) {
-    glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE,
-                        data);
+    // Rows of 1-3 byte formats are tightly packed, not padded to 4 bytes
+    bool packed = m_Format != TextureFormat::RGBA8 && m_Format != TextureFormat::RG32F;
+    if (packed) glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, m_DataType, data);
+
+    if (packed) glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 }
 
 }  // namespace ARcane
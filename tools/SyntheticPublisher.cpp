@@ -0,0 +1,152 @@
+// Standalone synthetic camera for load and latency testing of CameraStream.
+//
+// Usage:
+//   arcane-synthetic-publisher [--url tcp://*:5556] [--width 1280] [--height 720] [--fps 30]
+//                              [--quality 80] [--burst 1] [--unique 60] [--count 0]
+//                              [--header 1] [--camera-id 0] [--codec jpeg|h264|h265]
+//                              [--bitrate 4000000] [--keyint 30] [--verify 0]
+//
+// H.264/H.265 need ARcane built with libavcodec (and an encoder such as libx264 in it).
+// --url shm://name publishes through a shared memory ring instead of ZMQ.
+// --verify 1 decodes the encoded frames back instead of publishing, exit status 1 on a mismatch.
+
+#include "ARcane/Core/Log.hpp"
+#include "ARcane/Camera/SyntheticPublisher.hpp"
+
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+static std::atomic_bool s_Interrupted = false;
+
+// Whole-string parses, trailing junk is rejected
+static bool ParseUInt(const char* value, uint32_t& result) {
+    char* end = nullptr;
+    errno = 0;
+    unsigned long parsed = strtoul(value, &end, 10);
+    if (end == value || *end != '\0' || errno == ERANGE || value[0] == '-' || parsed > UINT32_MAX)
+        return false;
+    result = (uint32_t)parsed;
+    return true;
+}
+
+static bool ParseUInt64(const char* value, uint64_t& result) {
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long parsed = strtoull(value, &end, 10);
+    if (end == value || *end != '\0' || errno == ERANGE || value[0] == '-') return false;
+    result = parsed;
+    return true;
+}
+
+static bool ParseFloat(const char* value, float& result) {
+    char* end = nullptr;
+    errno = 0;
+    float parsed = strtof(value, &end);
+    if (end == value || *end != '\0' || errno == ERANGE || !std::isfinite(parsed)) return false;
+    result = parsed;
+    return true;
+}
+
+static bool ParseBool(const char* value, bool& result) {
+    uint32_t parsed = 0;
+    if (!ParseUInt(value, parsed)) return false;
+    result = parsed != 0;
+    return true;
+}
+
+static void PrintUsage() {
+    fprintf(stderr,
+            "Usage: arcane-synthetic-publisher [--url tcp://*:5556] [--width 1280] "
+            "[--height 720] [--fps 30] [--quality 80] [--burst 1] [--unique 60] [--count 0] "
+            "[--header 1] [--camera-id 0] [--codec jpeg|h264|h265] [--bitrate 4000000] "
+            "[--keyint 30] [--verify 0]\n");
+}
+
+int main(int argc, char** argv) {
+    ARcane::Log::Init();
+
+    ARcane::SyntheticPublisherSpecification spec;
+    bool verify = false;
+    for (int i = 1; i < argc; i++) {
+        const char* option = argv[i];
+        if (i + 1 >= argc) {
+            PrintUsage();
+            return 1;
+        }
+        const char* value = argv[++i];
+
+        uint32_t quality = 0;
+        bool valid = true;
+        if (!strcmp(option, "--url")) spec.Url = value;
+        else if (!strcmp(option, "--width")) valid = ParseUInt(value, spec.Width);
+        else if (!strcmp(option, "--height")) valid = ParseUInt(value, spec.Height);
+        else if (!strcmp(option, "--fps")) valid = ParseFloat(value, spec.FrameRate);
+        else if (!strcmp(option, "--quality")) {
+            valid = ParseUInt(value, quality) && quality <= 100;
+            spec.JpegQuality = (int)quality;
+        } else if (!strcmp(option, "--burst")) valid = ParseUInt(value, spec.BurstSize);
+        else if (!strcmp(option, "--unique")) valid = ParseUInt(value, spec.UniqueFrames);
+        else if (!strcmp(option, "--count")) valid = ParseUInt64(value, spec.FrameCount);
+        else if (!strcmp(option, "--header")) valid = ParseBool(value, spec.SendHeader);
+        else if (!strcmp(option, "--camera-id")) valid = ParseUInt(value, spec.CameraId);
+        else if (!strcmp(option, "--bitrate")) valid = ParseUInt(value, spec.VideoBitrate);
+        else if (!strcmp(option, "--keyint")) valid = ParseUInt(value, spec.KeyframeInterval);
+        else if (!strcmp(option, "--verify")) valid = ParseBool(value, verify);
+        else if (!strcmp(option, "--codec") && !strcmp(value, "jpeg"))
+            spec.Encoding = ARcane::FrameEncoding::JPEG;
+        else if (!strcmp(option, "--codec") && !strcmp(value, "h264"))
+            spec.Encoding = ARcane::FrameEncoding::H264;
+        else if (!strcmp(option, "--codec") && !strcmp(value, "h265"))
+            spec.Encoding = ARcane::FrameEncoding::H265;
+        else valid = false;
+
+        if (!valid) {
+            fprintf(stderr, "Invalid value '%s' for %s\n", value, option);
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    // Video encoders need even dimensions (4:2:0 chroma)
+    bool evenSize = spec.Width % 2 == 0 && spec.Height % 2 == 0;
+    if (spec.Width == 0 || spec.Height == 0 || !(spec.FrameRate > 0.0f) || spec.BurstSize == 0 ||
+        spec.UniqueFrames == 0 || (ARcane::IsInterFrameEncoding(spec.Encoding) && !evenSize)) {
+        fprintf(stderr, "--width, --height, --fps, --burst and --unique must be greater than 0, "
+                        "and --width/--height even for h264/h265\n");
+        PrintUsage();
+        return 1;
+    }
+
+    std::signal(SIGINT, [](int) { s_Interrupted = true; });
+    std::signal(SIGTERM, [](int) { s_Interrupted = true; });
+
+    // Nothing to bind for a verification run
+    if (verify) {
+        spec.Url = "inproc://arcane-synthetic-publisher-verify";
+        ARcane::SyntheticPublisher publisher(spec);
+        return publisher.Verify() ? 0 : 1;
+    }
+
+    ARcane::SyntheticPublisher publisher(spec);
+    publisher.Start();
+    ARC_CORE_INFO("Publishing {0}x{1} at {2} fps (bursts of {3}) on {4}", spec.Width, spec.Height,
+                  spec.FrameRate, spec.BurstSize, spec.Url);
+
+    uint64_t lastSent = 0, lastBytes = 0;
+    while (publisher.IsRunning() && !s_Interrupted) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+
+        uint64_t sent = publisher.GetSentCount(), bytes = publisher.GetBytesSent();
+        ARC_CORE_INFO("{0} fps, {1:.1f} Mbit/s, {2} sent", sent - lastSent,
+                      (bytes - lastBytes) * 8 / 1e6, sent);
+        lastSent = sent;
+        lastBytes = bytes;
+    }
+
+    publisher.Stop();
+    return 0;
+}